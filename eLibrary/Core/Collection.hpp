@@ -2,6 +2,7 @@
 
 #include <Core/Exception.hpp>
 
+#include <algorithm>
 #include <array>
 #include <mutex>
 #include <vector>
@@ -45,6 +46,15 @@ namespace eLibrary {
             std::copy(ElementList.begin(), ElementList.end(), ElementContainer);
         }
 
+        ArrayList(const ArrayList<E> &ElementSource) noexcept : ElementCapacity(0), ElementSize(0), ElementContainer(nullptr) {
+            doAssign(ElementSource);
+        }
+
+        ArrayList(ArrayList<E> &&ElementSource) noexcept : ElementCapacity(ElementSource.ElementCapacity), ElementSize(ElementSource.ElementSize), ElementContainer(ElementSource.ElementContainer) {
+            ElementSource.ElementCapacity = ElementSource.ElementSize = 0;
+            ElementSource.ElementContainer = nullptr;
+        }
+
         ~ArrayList() noexcept {
             doClear();
         }
@@ -52,12 +62,10 @@ namespace eLibrary {
         void addElement(const E &ElementSource) noexcept {
             if (ElementCapacity == 0) ElementContainer = new E[ElementCapacity = 1];
             if (ElementSize == ElementCapacity) {
-                auto *ElementBuffer = new E[ElementSize];
-                memcpy(ElementBuffer, ElementContainer, sizeof(E) * ElementSize);
+                auto *ElementBuffer = new E[ElementCapacity <<= 1];
+                std::move(ElementContainer, ElementContainer + ElementSize, ElementBuffer);
                 delete[] ElementContainer;
-                ElementContainer = new E[ElementCapacity <<= 1];
-                memcpy(ElementContainer, ElementBuffer, sizeof(E) * ElementSize);
-                delete[] ElementBuffer;
+                ElementContainer = ElementBuffer;
             }
             ElementContainer[ElementSize++] = ElementSource;
         }
@@ -68,15 +76,12 @@ namespace eLibrary {
                 throw Exception(String(u"ArrayList<E>::addElement(intmax_t, const E&) ElementIndex"));
             if (ElementCapacity == 0) ElementContainer = new E[ElementCapacity = 1];
             if (ElementSize == ElementCapacity) {
-                auto *ElementBuffer = new E[ElementSize];
-                memcpy(ElementBuffer, ElementContainer, sizeof(E) * ElementSize);
+                auto *ElementBuffer = new E[ElementCapacity <<= 1];
+                std::move(ElementContainer, ElementContainer + ElementSize, ElementBuffer);
                 delete[] ElementContainer;
-                ElementContainer = new E[ElementCapacity <<= 1];
-                memcpy(ElementContainer, ElementBuffer, sizeof(E) * ElementSize);
-                delete[] ElementBuffer;
+                ElementContainer = ElementBuffer;
             }
-            memcpy(ElementContainer + ElementIndex + 1, ElementContainer + ElementIndex,
-                   sizeof(E) * (ElementSize - ElementIndex - 1));
+            std::move_backward(ElementContainer + ElementIndex, ElementContainer + ElementSize, ElementContainer + ElementSize + 1);
             ElementContainer[ElementIndex] = ElementSource;
             ++ElementSize;
         }
@@ -85,7 +90,7 @@ namespace eLibrary {
             if (&ElementSource == this) return;
             delete[] ElementContainer;
             ElementContainer = new E[ElementCapacity = ElementSource.ElementCapacity];
-            memcpy(ElementContainer, ElementSource.ElementContainer, sizeof(E) * (ElementSize = ElementSource.ElementSize));
+            std::copy(ElementSource.ElementContainer, ElementSource.ElementContainer + (ElementSize = ElementSource.ElementSize), ElementContainer);
         }
 
         void doClear() noexcept {
@@ -104,6 +109,23 @@ namespace eLibrary {
             return ElementBuffer;
         }
 
+        void doResize(intmax_t ElementSizeTarget) {
+            if (ElementSizeTarget < 0) throw Exception(String(u"ArrayList<E>::doResize(intmax_t) ElementSizeTarget"));
+            if (!ElementSizeTarget) {
+                doClear();
+                return;
+            }
+            if (ElementSizeTarget > ElementCapacity) {
+                if (!ElementCapacity) ElementCapacity = 1;
+                while (ElementCapacity < ElementSizeTarget) ElementCapacity <<= 1;
+                auto *ElementBuffer = new E[ElementCapacity];
+                std::move(ElementContainer, ElementContainer + ElementSize, ElementBuffer);
+                delete[] ElementContainer;
+                ElementContainer = ElementBuffer;
+            }
+            ElementSize = ElementSizeTarget;
+        }
+
         void doReverse() noexcept {
             std::array<E, this->ElementSize> ElementBuffer;
             for (intmax_t ElementIndex = 0;ElementIndex < ElementSize;++ElementIndex)
@@ -111,13 +133,21 @@ namespace eLibrary {
             std::copy(ElementBuffer.begin(), ElementBuffer.end(), ElementContainer);
         }
 
-        E getElement(intmax_t ElementIndex) const {
+        const E &getElement(intmax_t ElementIndex) const {
             if (ElementIndex < 0) ElementIndex += ElementSize;
             if (ElementIndex < 0 || ElementIndex >= ElementSize)
                 throw Exception(String(u"ArrayList<E>::getElement(intmax_t) ElementIndex"));
             return ElementContainer[ElementIndex];
         }
 
+        E *getElementContainer() noexcept {
+            return ElementContainer;
+        }
+
+        const E *getElementContainer() const noexcept {
+            return ElementContainer;
+        }
+
         intmax_t getElementSize() const noexcept {
             return ElementSize;
         }
@@ -143,6 +173,17 @@ namespace eLibrary {
             return *this;
         }
 
+        ArrayList<E> &operator=(ArrayList<E> &&ElementSource) noexcept {
+            if (&ElementSource == this) return *this;
+            delete[] ElementContainer;
+            ElementCapacity = ElementSource.ElementCapacity;
+            ElementSize = ElementSource.ElementSize;
+            ElementContainer = ElementSource.ElementContainer;
+            ElementSource.ElementCapacity = ElementSource.ElementSize = 0;
+            ElementSource.ElementContainer = nullptr;
+            return *this;
+        }
+
         void removeElement(const E &ElementSource) {
             intmax_t ElementIndex = doFindElement(ElementSource);
             if (ElementIndex == -1) throw Exception(String(u"ArrayList<E>::removeElement(const E&) ElementSource"));
@@ -153,16 +194,13 @@ namespace eLibrary {
             if (ElementIndex < 0) ElementIndex += ElementSize;
             if (ElementIndex < 0 || ElementIndex >= ElementSize)
                 throw Exception(String(u"ArrayList<E>::removeElement(intmax_t) ElementIndex"));
-            memcpy(ElementContainer + ElementIndex, ElementContainer + ElementIndex + 1,
-                   sizeof(E) * (ElementSize - ElementIndex - 1));
+            std::move(ElementContainer + ElementIndex + 1, ElementContainer + ElementSize, ElementContainer + ElementIndex);
             if (ElementCapacity == 1) doClear();
             else if (--ElementSize <= ElementCapacity >> 1) {
-                auto *ElementBuffer = new E[ElementSize];
-                memcpy(ElementBuffer, ElementContainer, sizeof(E) * ElementSize);
+                auto *ElementBuffer = new E[ElementCapacity >>= 1];
+                std::move(ElementContainer, ElementContainer + ElementSize, ElementBuffer);
                 delete[] ElementContainer;
-                ElementContainer = new E[ElementCapacity >>= 1];
-                memcpy(ElementContainer, ElementBuffer, sizeof(E) * ElementSize);
-                delete[] ElementBuffer;
+                ElementContainer = ElementBuffer;
             }
         }
 
@@ -1,36 +1,222 @@
 #pragma once
 
+#include <Core/Collection.hpp>
 #include <Core/Number.hpp>
 
 #include <concepts>
+#include <initializer_list>
 #include <numbers>
 
 namespace eLibrary {
     class Mathematics final : public Object {
+    private:
+        template<std::floating_point T>
+        static T doCosineKernel(T NumberSource, T NumberTail) noexcept {
+            T NumberSquare = NumberSource * NumberSource, NumberHalf = NumberSquare * (T) 0.5, NumberResult = 1 - NumberHalf;
+            T NumberPolynomial = NumberSquare * ((T) 4.16666666666666019037e-02 + NumberSquare * ((T) -1.38888888888741095749e-03 + NumberSquare * ((T) 2.48015872894767294178e-05 + NumberSquare * ((T) -2.75573143513906633035e-07 + NumberSquare * ((T) 2.08757232129817482790e-09 + NumberSquare * (T) -1.13596475577881948265e-11)))));
+            return NumberResult + (((1 - NumberResult) - NumberHalf) + (NumberSquare * NumberPolynomial - NumberSource * NumberTail));
+        }
+
+        static void doFactorList(std::vector<uint64_t> &NumberFactorList, uint64_t &NumberFactor, uint64_t NumberSource) noexcept {
+            if (NumberSource > std::numeric_limits<uint64_t>::max() / NumberFactor) {
+                NumberFactorList.push_back(NumberFactor);
+                NumberFactor = 1;
+            }
+            NumberFactor *= NumberSource;
+        }
+
+        static Integer doProductTree(const uint64_t *NumberSource, size_t NumberSize) noexcept {
+            if (NumberSize <= 8) {
+                Integer NumberResult(1);
+                for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) NumberResult.doMultiplicationAssign(NumberSource[NumberPart]);
+                return NumberResult;
+            }
+            return doProductTree(NumberSource, NumberSize >> 1).doMultiplicationAssign(doProductTree(NumberSource + (NumberSize >> 1), NumberSize - (NumberSize >> 1)));
+        }
+
+        static BigFloat doSineCore(const BigFloat &NumberSource, bool NumberCosine) {
+            size_t NumberPrecision = NumberSource.getPrecision();
+            intmax_t NumberTop = NumberSource.isZero() ? 0 : NumberSource.getExponent() + (intmax_t) NumberSource.getMantissa().getBitLength();
+            size_t NumberPrecisionWorking = NumberPrecision + 64 + std::max(NumberTop, (intmax_t) 0);
+            Integer NumberMultiple;
+            BigFloat NumberRemainder;
+            for (;;) {
+                BigFloat NumberPiHalf(getPi(NumberPrecisionWorking).doShiftRight(1)), NumberQuotient(NumberSource.doDivision(NumberPiHalf));
+                NumberMultiple = NumberQuotient.doAddition(BigFloat(NumberQuotient.isNegative() ? -1 : 1, -1)).toInteger();
+                NumberRemainder = NumberSource.doSubtraction(NumberPiHalf.doMultiplication(BigFloat(NumberMultiple, 0, NumberPrecisionWorking))).setPrecision(NumberPrecisionWorking);
+                intmax_t NumberRemainderTop = NumberRemainder.isZero() ? -(intmax_t) NumberPrecisionWorking : NumberRemainder.getExponent() + (intmax_t) NumberRemainder.getMantissa().getBitLength();
+                if (!NumberMultiple.doCompare(0) || NumberRemainderTop > -32) break;
+                NumberPrecisionWorking += (size_t) (32 - NumberRemainderTop);
+            }
+            intmax_t NumberQuadrant = NumberMultiple.doModulo(4).getValue() + (NumberCosine ? 1 : 0);
+            if (NumberQuadrant < 0) NumberQuadrant += 4;
+            BigFloat NumberResult, NumberSquare(NumberRemainder.doMultiplication(NumberRemainder).getOpposite()), NumberTerminate;
+            uint64_t NumberDigit;
+            if (NumberQuadrant & 1) {
+                NumberResult = NumberTerminate = BigFloat(1, 0, NumberPrecisionWorking);
+                NumberDigit = 2;
+            } else {
+                NumberResult = NumberTerminate = NumberRemainder;
+                NumberDigit = 3;
+            }
+            BigFloat NumberLimit(NumberResult.getAbsolute().doShiftRight((intmax_t) NumberPrecisionWorking));
+            while (NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0) {
+                NumberTerminate = NumberTerminate.doMultiplication(NumberSquare).doDivision(BigFloat(Integer(NumberDigit * (NumberDigit - 1))));
+                NumberResult = NumberResult.doAddition(NumberTerminate);
+                NumberDigit += 2;
+            }
+            if (NumberQuadrant & 2) NumberResult = NumberResult.getOpposite();
+            return NumberResult.setPrecision(NumberPrecision);
+        }
+
+        template<std::floating_point T>
+        static T doSineKernel(T NumberSource, T NumberTail) noexcept {
+            T NumberSquare = NumberSource * NumberSource, NumberCube = NumberSquare * NumberSource;
+            T NumberPolynomial = (T) 8.33333333332248946124e-03 + NumberSquare * ((T) -1.98412698298579493134e-04 + NumberSquare * ((T) 2.75573137070700676789e-06 + NumberSquare * ((T) -2.50507602534068634195e-08 + NumberSquare * (T) 1.58969099521155010221e-10)));
+            return NumberSource - ((NumberSquare * (NumberTail * (T) 0.5 - NumberCube * NumberPolynomial) - NumberTail) - NumberCube * (T) -1.66666666666666324348e-01);
+        }
+
+        static Integer getFactorialOdd(uintmax_t NumberSource, const std::vector<uint64_t> &NumberPrimeList) noexcept {
+            if (NumberSource < 3) return 1;
+            Integer NumberResult(getFactorialOdd(NumberSource >> 1, NumberPrimeList));
+            NumberResult.doMultiplicationAssign(NumberResult);
+            std::vector<uint64_t> NumberFactorList;
+            uint64_t NumberFactor = 1;
+            for (size_t NumberIndex = 1; NumberIndex < NumberPrimeList.size() && NumberPrimeList[NumberIndex] <= NumberSource; ++NumberIndex) {
+                uint64_t NumberPrime = NumberPrimeList[NumberIndex], NumberPower = 1;
+                for (uintmax_t NumberQuotient = NumberSource / NumberPrime; NumberQuotient; NumberQuotient /= NumberPrime)
+                    if (NumberQuotient & 1) NumberPower *= NumberPrime;
+                if (NumberPower > 1) doFactorList(NumberFactorList, NumberFactor, NumberPower);
+            }
+            if (NumberFactor > 1) NumberFactorList.push_back(NumberFactor);
+            return NumberResult.doMultiplicationAssign(doProductTree(NumberFactorList.data(), NumberFactorList.size()));
+        }
+
+        static BigFloat getInverseTangent(uint64_t NumberSource, size_t NumberPrecision, bool NumberHyperbolic) noexcept {
+            BigFloat NumberPower(BigFloat(1, 0, NumberPrecision).doDivision(BigFloat(NumberSource))), NumberResult(NumberPower), NumberSquare(Integer(NumberSource * NumberSource)), NumberLimit(1, -(intmax_t) NumberPrecision);
+            for (uint64_t NumberDigit = 3; NumberPower.doCompare(NumberLimit) > 0; NumberDigit += 2) {
+                NumberPower = NumberPower.doDivision(NumberSquare);
+                BigFloat NumberTerminate(NumberPower.doDivision(BigFloat(NumberDigit)));
+                NumberResult = NumberHyperbolic || !(NumberDigit & 2) ? NumberResult.doAddition(NumberTerminate) : NumberResult.doSubtraction(NumberTerminate);
+            }
+            return NumberResult;
+        }
+
+        static BigFloat getLogarithm2(size_t NumberPrecision) noexcept {
+            thread_local BigFloat NumberCache;
+            if (NumberCache.isZero() || NumberCache.getPrecision() < NumberPrecision) {
+                size_t NumberPrecisionWorking = NumberPrecision + 16;
+                NumberCache = getInverseTangent(26, NumberPrecisionWorking, true).doMultiplication(BigFloat(18)).doSubtraction(getInverseTangent(4801, NumberPrecisionWorking, true).doShiftLeft(1)).doAddition(getInverseTangent(8749, NumberPrecisionWorking, true).doShiftLeft(3));
+            }
+            return BigFloat(NumberCache).setPrecision(NumberPrecision);
+        }
+
+        static BigFloat getPi(size_t NumberPrecision) noexcept {
+            thread_local BigFloat NumberCache;
+            if (NumberCache.isZero() || NumberCache.getPrecision() < NumberPrecision) {
+                size_t NumberPrecisionWorking = NumberPrecision + 16;
+                NumberCache = getInverseTangent(5, NumberPrecisionWorking, false).doShiftLeft(4).doSubtraction(getInverseTangent(239, NumberPrecisionWorking, false).doShiftLeft(2));
+            }
+            return BigFloat(NumberCache).setPrecision(NumberPrecision);
+        }
+
+        static std::vector<uint64_t> getPrimeList(uintmax_t NumberLimit) noexcept {
+            std::vector<uint64_t> NumberPrimeList;
+            if (NumberLimit < 2) return NumberPrimeList;
+            NumberPrimeList.push_back(2);
+            std::vector<bool> NumberComposite((NumberLimit + 1) >> 1);
+            for (uintmax_t NumberIndex = 1; NumberIndex < NumberComposite.size(); ++NumberIndex) {
+                if (NumberComposite[NumberIndex]) continue;
+                uintmax_t NumberPrime = (NumberIndex << 1) + 1;
+                NumberPrimeList.push_back(NumberPrime);
+                for (uintmax_t NumberMultiple = NumberPrime * NumberPrime >> 1; NumberMultiple < NumberComposite.size(); NumberMultiple += NumberPrime)
+                    NumberComposite[NumberMultiple] = true;
+            }
+            return NumberPrimeList;
+        }
+
+        template<std::floating_point T>
+        static T getRemainderPiHalf(T NumberSource, T &NumberTail, intmax_t &NumberQuadrant) noexcept {
+            if (std::abs(NumberSource) < (T) 7.45058059692382812500e-09) {
+                NumberTail = 0;
+                NumberQuadrant = 0;
+                return NumberSource;
+            }
+            T NumberResult;
+            if (std::abs(NumberSource) < (T) 1.6e6) {
+                T NumberMultiple = std::nearbyint(NumberSource * (T) 6.36619772367581382433e-01);
+                T NumberHead = NumberSource - NumberMultiple * (T) 1.57079632673412561417e+00, NumberPart = NumberMultiple * (T) 6.07710050630396597660e-11;
+                NumberResult = NumberHead - NumberPart;
+                T NumberVirtual = NumberHead - NumberResult;
+                NumberTail = ((NumberHead - (NumberResult + NumberVirtual)) + (NumberVirtual - NumberPart)) - NumberMultiple * (T) 2.02226624871116645580e-21 - NumberMultiple * (T) 8.47842766036889956997e-32;
+                NumberQuadrant = (intmax_t) NumberMultiple;
+            } else {
+                BigFloat NumberValue(NumberSource, std::numeric_limits<T>::digits);
+                int NumberExponent;
+                std::frexp(NumberSource, &NumberExponent);
+                BigFloat NumberPiHalf(getPi(NumberExponent + 128).doShiftRight(1)), NumberQuotient(NumberValue.doDivision(NumberPiHalf));
+                Integer NumberMultiple(NumberQuotient.doAddition(BigFloat(NumberQuotient.isNegative() ? -1 : 1, -1)).toInteger());
+                BigFloat NumberRemainder(NumberValue.doSubtraction(NumberPiHalf.doMultiplication(BigFloat(NumberMultiple, 0, NumberExponent + 128))));
+                NumberResult = NumberRemainder.getValue<T>();
+                NumberTail = NumberRemainder.doSubtraction(BigFloat(NumberResult, std::numeric_limits<T>::digits)).getValue<T>();
+                NumberQuadrant = NumberMultiple.doModulo(4).getValue();
+            }
+            T NumberSum = NumberResult + NumberTail;
+            NumberTail -= NumberSum - NumberResult;
+            return NumberSum;
+        }
+
     public:
         Mathematics() = delete;
 
+        template<unsigned short NumberScale>
+        static ArrayList<Decimal<NumberScale>> doAdditionBatch(const ArrayList<Decimal<NumberScale>> &NumberSource1, const ArrayList<Decimal<NumberScale>> &NumberSource2) {
+            if (NumberSource1.getElementSize() != NumberSource2.getElementSize())
+                throw Exception(String(u"Mathematics::doAdditionBatch(const ArrayList<Decimal>&, const ArrayList<Decimal>&) NumberSource2"));
+            ArrayList<Decimal<NumberScale>> NumberResult;
+            NumberResult.doResize(NumberSource1.getElementSize());
+            Decimal<NumberScale>::doAdditionBatch(NumberSource1.getElementContainer(), NumberSource2.getElementContainer(), NumberResult.getElementContainer(), NumberSource1.getElementSize());
+            return NumberResult;
+        }
+
         template<std::floating_point T>
         static T doCosine(T NumberSource) noexcept {
-            T NumberResult = 1, NumberTerminate = 1;
-            unsigned short NumberDigit = 2;
-            while (std::abs(NumberTerminate) > 1e-12) {
-                NumberTerminate *= -(NumberSource * NumberSource / (NumberDigit * (NumberDigit - 1)));
-                NumberResult += NumberTerminate;
-                NumberDigit += 2;
+            if constexpr (std::is_same_v<T, float>) return (float) doCosine((double) NumberSource);
+            else {
+                if (!std::isfinite(NumberSource)) return std::numeric_limits<T>::quiet_NaN();
+                intmax_t NumberQuadrant;
+                T NumberTail, NumberRemainder = getRemainderPiHalf(NumberSource, NumberTail, NumberQuadrant);
+                T NumberResult = NumberQuadrant & 1 ? doSineKernel(NumberRemainder, NumberTail) : doCosineKernel(NumberRemainder, NumberTail);
+                return (NumberQuadrant + 1) & 2 ? -NumberResult : NumberResult;
             }
-            return NumberResult;
         }
 
         static Fraction doCosineFraction(const Fraction &NumberSource, const Integer &NumberPrecision = Integer(10000000)) noexcept {
-            Fraction NumberResult(1), NumberTerminate(1);
-            unsigned short NumberDigit = 2;
-            while (NumberTerminate.getAbsolute().doCompare({1, NumberPrecision}) > 0) {
-                NumberTerminate = NumberTerminate.doMultiplication(NumberSource.doMultiplication(NumberSource).doDivision(Integer(NumberDigit * (NumberDigit - 1))).getOpposite());
-                NumberResult = NumberResult.doAddition(NumberTerminate);
-                NumberDigit += 2;
+            Fraction NumberResult(1);
+            {
+                Integer::ScratchScope NumberScope;
+                Fraction NumberLimit(1, NumberPrecision), NumberSquare(NumberSource.doMultiplication(NumberSource).getOpposite()), NumberTerminate(1);
+                unsigned short NumberDigit = 2;
+                while (NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0) {
+                    NumberTerminate = NumberTerminate.doMultiplication(NumberSquare.doDivision(Integer(NumberDigit * (NumberDigit - 1))));
+                    NumberResult = NumberResult.doAddition(NumberTerminate);
+                    NumberDigit += 2;
+                }
             }
-            return NumberResult;
+            return Fraction(NumberResult);
+        }
+
+        static BigFloat doCosineBigFloat(const BigFloat &NumberSource) {
+            return doSineCore(NumberSource, true);
+        }
+
+        static Integer doDotProduct(const ArrayList<Integer> &NumberSource1, const ArrayList<Integer> &NumberSource2) {
+            if (NumberSource1.getElementSize() != NumberSource2.getElementSize())
+                throw Exception(String(u"Mathematics::doDotProduct(const ArrayList<Integer>&, const ArrayList<Integer>&) NumberSource2"));
+            IntegerAccumulator NumberAccumulator;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberSource1.getElementSize(); ++NumberIndex)
+                NumberAccumulator.doMultiplicationAdditionAssign(NumberSource1.getElement(NumberIndex), NumberSource2.getElement(NumberIndex));
+            return NumberAccumulator.getValue();
         }
 
         template<std::floating_point T>
@@ -44,27 +230,49 @@ namespace eLibrary {
 
         template<std::floating_point T>
         static T doExponent(T NumberSource) noexcept {
-            T NumberDenominator = 1, NumberNumerator = NumberSource, NumberResult = 1, NumberTerminate = NumberSource;
-            unsigned short NumberDigit = 1;
-            while (std::abs(NumberTerminate) > 1e-12) {
-                NumberResult += NumberTerminate;
-                NumberNumerator *= NumberSource;
-                NumberDenominator *= ++NumberDigit;
-                NumberTerminate = NumberNumerator / NumberDenominator;
+            if constexpr (std::is_same_v<T, float>) return (float) doExponent((double) NumberSource);
+            else {
+                if (std::isnan(NumberSource)) return NumberSource;
+                if (NumberSource > (T) (std::numeric_limits<T>::max_exponent + 1) * std::numbers::ln2_v<T>) return std::numeric_limits<T>::infinity();
+                if (NumberSource < (T) (std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 1) * std::numbers::ln2_v<T>) return 0;
+                T NumberMultiple = std::nearbyint(NumberSource * std::numbers::log2e_v<T>);
+                T NumberHigh = NumberSource - NumberMultiple * (T) 6.93147180369123816490e-01, NumberLow = NumberMultiple * (T) 1.90821492927058770002e-10, NumberRemainder = NumberHigh - NumberLow, NumberSquare = NumberRemainder * NumberRemainder;
+                T NumberCorrection = NumberRemainder - NumberSquare * ((T) 1.66666666666666019037e-01 + NumberSquare * ((T) -2.77777777770155933842e-03 + NumberSquare * ((T) 6.61375632143793436117e-05 + NumberSquare * ((T) -1.65339022054652515390e-06 + NumberSquare * (T) 4.13813679705723846039e-08))));
+                return std::ldexp(1 - ((NumberLow - NumberRemainder * NumberCorrection / (2 - NumberCorrection)) - NumberHigh), (int) NumberMultiple);
             }
-            return NumberResult;
         }
 
-        static Fraction doExponentFraction(const Fraction &NumberSource, const Integer &NumberPrecision = Integer(10000000)) noexcept {
-            Fraction NumberDenominator(1), NumberNumerator = NumberSource, NumberResult(1), NumberTerminate = NumberSource;
-            unsigned short NumberDigit = 1;
-            while (NumberTerminate.getAbsolute().doCompare({1, NumberPrecision}) > 0) {
+        static BigFloat doExponentBigFloat(const BigFloat &NumberSource) {
+            size_t NumberPrecision = NumberSource.getPrecision();
+            if (NumberSource.isZero()) return {1, 0, NumberPrecision};
+            intmax_t NumberTop = NumberSource.getExponent() + (intmax_t) NumberSource.getMantissa().getBitLength();
+            if (NumberTop > 60) throw Exception(String(u"Mathematics::doExponentBigFloat(const BigFloat&) NumberSource"));
+            size_t NumberHalving = std::bit_width(NumberPrecision) << 1, NumberPrecisionWorking = NumberPrecision + 64 + NumberHalving;
+            BigFloat NumberLogarithm2(getLogarithm2(NumberPrecisionWorking + std::max(NumberTop, (intmax_t) 0) + 2));
+            Integer NumberMultiple(NumberSource.doDivision(NumberLogarithm2).toInteger());
+            BigFloat NumberReduced(NumberSource.doSubtraction(NumberLogarithm2.doMultiplication(BigFloat(NumberMultiple, 0, 64))).setPrecision(NumberPrecisionWorking).doShiftRight((intmax_t) NumberHalving));
+            BigFloat NumberLimit(1, -(intmax_t) NumberPrecisionWorking), NumberResult(1, 0, NumberPrecisionWorking), NumberTerminate(NumberReduced);
+            uint64_t NumberDigit = 1;
+            while (NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0) {
                 NumberResult = NumberResult.doAddition(NumberTerminate);
-                NumberNumerator = NumberNumerator.doMultiplication(NumberSource);
-                NumberDenominator = NumberDenominator.doMultiplication(Integer(++NumberDigit));
-                NumberTerminate = NumberNumerator.doDivision(NumberDenominator);
+                NumberTerminate = NumberTerminate.doMultiplication(NumberReduced).doDivision(BigFloat(++NumberDigit));
             }
-            return NumberResult;
+            for (size_t NumberIndex = 0; NumberIndex < NumberHalving; ++NumberIndex) NumberResult = NumberResult.doMultiplication(NumberResult);
+            return NumberResult.doShiftLeft(NumberMultiple.getValue()).setPrecision(NumberPrecision);
+        }
+
+        static Fraction doExponentFraction(const Fraction &NumberSource, const Integer &NumberPrecision = Integer(10000000)) noexcept {
+            Fraction NumberResult(1);
+            {
+                Integer::ScratchScope NumberScope;
+                Fraction NumberLimit(1, NumberPrecision), NumberTerminate = NumberSource;
+                unsigned short NumberDigit = 1;
+                while (NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0) {
+                    NumberResult = NumberResult.doAddition(NumberTerminate);
+                    NumberTerminate = NumberTerminate.doMultiplication(NumberSource.doDivision(Integer(++NumberDigit)));
+                }
+            }
+            return Fraction(NumberResult);
         }
 
         template<std::floating_point T>
@@ -108,26 +316,80 @@ namespace eLibrary {
         }
 
         static Fraction doInverseHyperbolicTangentFraction(const Fraction &NumberDegree, const Integer &NumberPrecision = Integer(10000000)) noexcept {
-            Fraction NumberNumerator(NumberDegree), NumberResult(0), NumberTerminate(NumberDegree);
-            unsigned short NumberDigit = 1;
-            while (NumberTerminate.getAbsolute().doCompare({1, NumberPrecision}) > 0) {
-                NumberResult = NumberResult.doAddition(NumberTerminate);
-                NumberNumerator = NumberNumerator.doMultiplication(NumberDegree.doMultiplication(NumberDegree));
-                NumberDigit += 2;
-                NumberTerminate = NumberNumerator.doDivision(Integer(NumberDigit));
+            Fraction NumberResult(0);
+            {
+                Integer::ScratchScope NumberScope;
+                Fraction NumberLimit(1, NumberPrecision), NumberNumerator(NumberDegree), NumberSquare(NumberDegree.doMultiplication(NumberDegree)), NumberTerminate(NumberDegree);
+                unsigned short NumberDigit = 1;
+                while (NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0) {
+                    NumberResult = NumberResult.doAddition(NumberTerminate);
+                    NumberNumerator = NumberNumerator.doMultiplication(NumberSquare);
+                    NumberDigit += 2;
+                    NumberTerminate = NumberNumerator.doDivision(Integer(NumberDigit));
+                }
             }
-            return NumberResult;
+            return Fraction(NumberResult);
         }
 
         template<std::floating_point T>
         static T doLogarithmE(T NumberSource) noexcept {
-            return doInverseHyperbolicTangent((NumberSource - 1) / (NumberSource + 1)) * 2;
+            if constexpr (std::is_same_v<T, float>) return (float) doLogarithmE((double) NumberSource);
+            else {
+                if (std::isnan(NumberSource) || NumberSource < 0) return std::numeric_limits<T>::quiet_NaN();
+                if (NumberSource == 0) return -std::numeric_limits<T>::infinity();
+                if (std::isinf(NumberSource)) return NumberSource;
+                int NumberExponent;
+                T NumberMantissa = std::frexp(NumberSource, &NumberExponent);
+                if (NumberMantissa < std::numbers::sqrt2_v<T> / 2) {
+                    NumberMantissa *= 2;
+                    --NumberExponent;
+                }
+                T NumberFraction = NumberMantissa - 1, NumberHalfSquare = NumberFraction * NumberFraction * (T) 0.5, NumberRatio = NumberFraction / (2 + NumberFraction), NumberSquare = NumberRatio * NumberRatio;
+                T NumberPolynomial = NumberSquare * ((T) 6.666666666666735130e-01 + NumberSquare * ((T) 3.999999999940941908e-01 + NumberSquare * ((T) 2.857142874366239149e-01 + NumberSquare * ((T) 2.222219843214978396e-01 + NumberSquare * ((T) 1.818357216161805012e-01 + NumberSquare * ((T) 1.531383769920937332e-01 + NumberSquare * (T) 1.479819860511658591e-01))))));
+                return (T) NumberExponent * (T) 6.93147180369123816490e-01 - ((NumberHalfSquare - (NumberRatio * (NumberHalfSquare + NumberPolynomial) + (T) NumberExponent * (T) 1.90821492927058770002e-10)) - NumberFraction);
+            }
+        }
+
+        static BigFloat doLogarithmEBigFloat(const BigFloat &NumberSource) {
+            if (!NumberSource.isPositive()) throw Exception(String(u"Mathematics::doLogarithmEBigFloat(const BigFloat&) NumberSource"));
+            size_t NumberPrecision = NumberSource.getPrecision(), NumberRootLimit = std::bit_width(NumberPrecision), NumberPrecisionWorking = NumberPrecision + 64 + NumberRootLimit;
+            intmax_t NumberTop = NumberSource.getExponent() + (intmax_t) NumberSource.getMantissa().getBitLength();
+            BigFloat NumberReduced(NumberSource.doShiftRight(NumberTop)), NumberOne(1, 0, NumberPrecisionWorking), NumberThreshold(1, -(intmax_t) NumberRootLimit);
+            NumberReduced.setPrecision(NumberPrecisionWorking);
+            if (NumberReduced.doCompare(BigFloat(3, -2)) < 0) {
+                NumberReduced = NumberReduced.doShiftLeft(1);
+                --NumberTop;
+            }
+            size_t NumberRootCount = 0;
+            while (NumberReduced.doSubtraction(NumberOne).getAbsolute().doCompare(NumberThreshold) > 0) {
+                NumberReduced = NumberReduced.getSquareRoot();
+                ++NumberRootCount;
+            }
+            BigFloat NumberRatio(NumberReduced.doSubtraction(NumberOne).doDivision(NumberReduced.doAddition(NumberOne)));
+            BigFloat NumberLimit(NumberRatio.getAbsolute().doShiftRight((intmax_t) NumberPrecisionWorking)), NumberResult(NumberRatio), NumberSquare(NumberRatio.doMultiplication(NumberRatio)), NumberTerminate(NumberRatio);
+            for (uint64_t NumberDigit = 3; NumberTerminate.getAbsolute().doCompare(NumberLimit) > 0; NumberDigit += 2) {
+                NumberTerminate = NumberTerminate.doMultiplication(NumberSquare);
+                NumberResult = NumberResult.doAddition(NumberTerminate.doDivision(BigFloat(NumberDigit)));
+            }
+            NumberResult = NumberResult.doShiftLeft((intmax_t) NumberRootCount + 1);
+            if (NumberTop) NumberResult = NumberResult.doAddition(getLogarithm2(NumberPrecisionWorking + std::bit_width((uintmax_t) std::abs(NumberTop))).doMultiplication(BigFloat(NumberTop, 0, 64)));
+            return NumberResult.setPrecision(NumberPrecision);
         }
 
         static Fraction doLogarithmEFraction(const Fraction &NumberSource) noexcept {
             return doInverseHyperbolicTangentFraction(NumberSource.doSubtraction(Integer(1)).doDivision(NumberSource.doAddition(Integer(1)))).doMultiplication(Integer(2));
         }
 
+        template<unsigned short NumberScale>
+        static ArrayList<Decimal<NumberScale>> doMultiplicationBatch(const ArrayList<Decimal<NumberScale>> &NumberSource1, const ArrayList<Decimal<NumberScale>> &NumberSource2) {
+            if (NumberSource1.getElementSize() != NumberSource2.getElementSize())
+                throw Exception(String(u"Mathematics::doMultiplicationBatch(const ArrayList<Decimal>&, const ArrayList<Decimal>&) NumberSource2"));
+            ArrayList<Decimal<NumberScale>> NumberResult;
+            NumberResult.doResize(NumberSource1.getElementSize());
+            Decimal<NumberScale>::doMultiplicationBatch(NumberSource1.getElementContainer(), NumberSource2.getElementContainer(), NumberResult.getElementContainer(), NumberSource1.getElementSize());
+            return NumberResult;
+        }
+
         template<std::floating_point T>
         static T doPower(T NumberBase, T NumberExponent) noexcept {
             return doExponent(doLogarithmE(NumberBase) * NumberExponent);
@@ -144,25 +406,77 @@ namespace eLibrary {
             return NumberResult;
         }
 
+        template<size_t NumberBitCount, bool NumberSigned>
+        static constexpr FixedInteger<NumberBitCount, NumberSigned> doPower(const FixedInteger<NumberBitCount, NumberSigned> &NumberBase, const FixedInteger<NumberBitCount, NumberSigned> &NumberExponent) {
+            return NumberBase.doPower(NumberExponent);
+        }
+
+        template<size_t NumberBitCount, bool NumberSigned>
+        static constexpr FixedInteger<NumberBitCount, NumberSigned> doPower(const FixedInteger<NumberBitCount, NumberSigned> &NumberBase, const FixedInteger<NumberBitCount, NumberSigned> &NumberExponent, const FixedInteger<NumberBitCount, NumberSigned> &NumberModulo) {
+            return NumberBase.doPower(NumberExponent, NumberModulo);
+        }
+
+        static BigFloat doPowerBigFloat(const BigFloat &NumberBase, const BigFloat &NumberExponent) {
+            size_t NumberPrecision = std::max(NumberBase.getPrecision(), NumberExponent.getPrecision());
+            if (NumberExponent.isZero()) return {1, 0, NumberPrecision};
+            if (NumberExponent.getExponent() >= 0) {
+                Integer NumberPower(NumberExponent.toInteger());
+                if (NumberBase.isZero()) {
+                    if (NumberPower.isNegative()) throw Exception(String(u"Mathematics::doPowerBigFloat(const BigFloat&, const BigFloat&) NumberBase"));
+                    return {0, 0, NumberPrecision};
+                }
+                size_t NumberPrecisionWorking = NumberPrecision + 64 + NumberPower.getBitLength();
+                BigFloat NumberResult(1, 0, NumberPrecisionWorking);
+                for (size_t NumberBit = NumberPower.getBitLength(); NumberBit > 0; --NumberBit) {
+                    NumberResult = NumberResult.doMultiplication(NumberResult);
+                    if (NumberPower.isBitSet(NumberBit - 1)) NumberResult = NumberResult.doMultiplication(NumberBase);
+                }
+                if (NumberPower.isNegative()) NumberResult = BigFloat(1, 0, NumberPrecisionWorking).doDivision(NumberResult);
+                return NumberResult.setPrecision(NumberPrecision);
+            }
+            if (NumberBase.isZero() && NumberExponent.isPositive()) return {0, 0, NumberPrecision};
+            if (!NumberBase.isPositive()) throw Exception(String(u"Mathematics::doPowerBigFloat(const BigFloat&, const BigFloat&) NumberBase"));
+            intmax_t NumberTop = NumberBase.getExponent() + (intmax_t) NumberBase.getMantissa().getBitLength();
+            NumberTop = NumberExponent.getExponent() + (intmax_t) NumberExponent.getMantissa().getBitLength() + std::bit_width((uintmax_t) std::abs(NumberTop)) + 1;
+            size_t NumberPrecisionWorking = NumberPrecision + 64 + std::max(NumberTop, (intmax_t) 0);
+            BigFloat NumberLogarithm(doLogarithmEBigFloat(BigFloat(NumberBase).setPrecision(NumberPrecisionWorking)));
+            return doExponentBigFloat(NumberLogarithm.doMultiplication(NumberExponent).setPrecision(NumberPrecisionWorking)).setPrecision(NumberPrecision);
+        }
+
         static Fraction doPowerFraction(const Fraction &NumberBase, const Fraction &NumberExponent) noexcept {
             return doExponentFraction(doLogarithmEFraction(NumberBase).doMultiplication(NumberExponent));
         }
 
+        template<unsigned short NumberScale>
+        static ArrayList<Decimal<NumberScale>> doRoundBatch(const ArrayList<Decimal<NumberScale>> &NumberSource, unsigned short NumberDigit) {
+            if (NumberDigit >= NumberScale) return NumberSource;
+            ArrayList<Decimal<NumberScale>> NumberResult;
+            NumberResult.doResize(NumberSource.getElementSize());
+            Decimal<NumberScale>::doRoundBatch(NumberSource.getElementContainer(), NumberResult.getElementContainer(), NumberSource.getElementSize(), NumberDigit);
+            return NumberResult;
+        }
+
         template<std::floating_point T>
         static T doSine(T NumberSource) noexcept {
-            NumberSource -= (int)std::abs(NumberSource / (std::numbers::pi * 2)) * 2 * std::numbers::pi;
-            if (!NumberSource) return 0;
-            T NumberDenominator = 1, NumberNumerator = NumberSource, NumberResult = 0, NumberSignature = 1, NumberTerminate = NumberSource;
-            unsigned short NumberDigit = 1;
-            while (std::abs(NumberTerminate) >= 1e-12) {
-                NumberResult += NumberTerminate;
-                ++NumberDigit;
-                NumberSignature = -NumberSignature;
-                NumberDenominator *= ((NumberDigit << 1) - 2) * ((NumberDigit << 1) - 1);
-                NumberNumerator *= NumberSource * NumberSource;
-                NumberTerminate = NumberSignature * (NumberNumerator / NumberDenominator);
+            if constexpr (std::is_same_v<T, float>) return (float) doSine((double) NumberSource);
+            else {
+                if (!std::isfinite(NumberSource)) return std::numeric_limits<T>::quiet_NaN();
+                intmax_t NumberQuadrant;
+                T NumberTail, NumberRemainder = getRemainderPiHalf(NumberSource, NumberTail, NumberQuadrant);
+                T NumberResult = NumberQuadrant & 1 ? doCosineKernel(NumberRemainder, NumberTail) : doSineKernel(NumberRemainder, NumberTail);
+                return NumberQuadrant & 2 ? -NumberResult : NumberResult;
             }
-            return NumberResult;
+        }
+
+        static BigFloat doSineBigFloat(const BigFloat &NumberSource) {
+            return doSineCore(NumberSource, false);
+        }
+
+        static Integer doSummation(const ArrayList<Integer> &NumberSource) noexcept {
+            IntegerAccumulator NumberAccumulator;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberSource.getElementSize(); ++NumberIndex)
+                NumberAccumulator.doAdditionAssign(NumberSource.getElement(NumberIndex));
+            return NumberAccumulator.getValue();
         }
 
         template<std::floating_point T>
@@ -175,9 +489,29 @@ namespace eLibrary {
             return NumberSource >= 0 ? NumberSource : -NumberSource;
         }
 
+        static Integer getBinomial(uintmax_t NumberN, uintmax_t NumberK) noexcept {
+            if (NumberK > NumberN) return 0;
+            if (NumberK > NumberN - NumberK) NumberK = NumberN - NumberK;
+            std::vector<uint64_t> NumberFactorList, NumberPrimeList(getPrimeList(NumberN));
+            uint64_t NumberFactor = 1;
+            for (uint64_t NumberPrime : NumberPrimeList) {
+                uint64_t NumberPower = 1;
+                if (NumberPrime > NumberN - NumberK) NumberPower = NumberPrime;
+                else if (NumberPrime > NumberN >> 1) continue;
+                else for (uintmax_t NumberQuotientN = NumberN, NumberQuotientK = NumberK, NumberBorrow = 0; NumberQuotientN; NumberQuotientN /= NumberPrime, NumberQuotientK /= NumberPrime)
+                    if ((NumberBorrow = NumberQuotientN % NumberPrime < NumberQuotientK % NumberPrime + NumberBorrow)) NumberPower *= NumberPrime;
+                if (NumberPower > 1) doFactorList(NumberFactorList, NumberFactor, NumberPower);
+            }
+            if (NumberFactor > 1) NumberFactorList.push_back(NumberFactor);
+            return doProductTree(NumberFactorList.data(), NumberFactorList.size());
+        }
+
+        static Integer getFactorial(uintmax_t NumberSource) noexcept {
+            return getFactorialOdd(NumberSource, getPrimeList(NumberSource)).doShiftLeftAssign(NumberSource - std::popcount(NumberSource));
+        }
+
         static Integer getGreatestCommonFactor(const Integer &Number1, const Integer &Number2) noexcept {
-            if (!Number2.getAbsolute().doCompare(0)) return Number1;
-            return getGreatestCommonFactor(Number2, Number1.doModulo(Number2));
+            return Number1.getGreatestCommonFactor(Number2);
         }
 
         static Integer getJocabiSymbol(const Integer &NumberMSource, const Integer &NumberNSource) {
@@ -189,22 +523,38 @@ namespace eLibrary {
             Integer NumberJ(1);
             if (NumberM.isNegative()) {
                 NumberM = NumberM.getOpposite();
-                if (!NumberN.doModulo(4).doCompare(3)) NumberJ = NumberJ.getOpposite();
+                if (NumberN.isBitSet(1)) NumberJ = NumberJ.getOpposite();
             }
             while (NumberM.doCompare(0)) {
-                while (NumberM.isEven() && NumberM.isPositive()) {
-                    NumberM = NumberM.doDivision(2);
-                    if (!NumberN.doModulo(8).doCompare(3) || !NumberN.doModulo(8).doCompare(5))
-                        NumberJ = NumberJ.getOpposite();
-                }
+                size_t NumberShift = NumberM.getTrailingZeroCount();
+                NumberM.doShiftRightAssign(NumberShift);
+                if ((NumberShift & 1) && NumberN.isBitSet(1) != NumberN.isBitSet(2)) NumberJ = NumberJ.getOpposite();
                 std::swap(NumberM, NumberN);
-                if (!NumberM.doModulo(4).doCompare(3) && !NumberN.doModulo(4).doCompare(3)) NumberJ = NumberJ.getOpposite();
-                NumberM = NumberM.doModulo(NumberN);
+                if (NumberM.isBitSet(1) && NumberN.isBitSet(1)) NumberJ = NumberJ.getOpposite();
+                NumberM.doModuloAssign(NumberN);
             }
             if (NumberN.doCompare(1)) NumberJ = 0;
             return NumberJ;
         }
 
+        template<std::signed_integral T>
+        static constexpr T getJocabiSymbol(T NumberM, T NumberN) {
+            if (NumberN <= 0 || !(NumberN & 1)) throw Exception(String(u"Mathematics::getJocabiSymbol(T, T) NumberN"));
+            NumberM %= NumberN;
+            if (NumberM < 0) NumberM += NumberN;
+            T NumberJ = 1;
+            while (NumberM) {
+                while (!(NumberM & 1)) {
+                    NumberM >>= 1;
+                    if ((NumberN & 7) == 3 || (NumberN & 7) == 5) NumberJ = -NumberJ;
+                }
+                std::swap(NumberM, NumberN);
+                if ((NumberM & 3) == 3 && (NumberN & 3) == 3) NumberJ = -NumberJ;
+                NumberM %= NumberN;
+            }
+            return NumberN == 1 ? NumberJ : 0;
+        }
+
         template<std::unsigned_integral T>
         static T getNearestPower2Lower(T NumberSource) noexcept {
             NumberSource |= NumberSource >> 1;
@@ -225,6 +575,14 @@ namespace eLibrary {
             return (NumberSource < 0) ? 1 : NumberSource + 1;
         }
 
+        static Integer getPrimorial(uintmax_t NumberSource) noexcept {
+            std::vector<uint64_t> NumberFactorList, NumberPrimeList(getPrimeList(NumberSource));
+            uint64_t NumberFactor = 1;
+            for (uint64_t NumberPrime : NumberPrimeList) doFactorList(NumberFactorList, NumberFactor, NumberPrime);
+            if (NumberFactor > 1) NumberFactorList.push_back(NumberFactor);
+            return doProductTree(NumberFactorList.data(), NumberFactorList.size());
+        }
+
         template<std::unsigned_integral T>
         static T getTrailingZeroCount(T NumberSource) noexcept {
             constexpr int ConvertTable[64] = {
@@ -235,10 +593,8 @@ namespace eLibrary {
             return ConvertTable[(NumberSource & ~(NumberSource - 1)) * 0x022FDD63CC95386D >> 58];
         }
 
-        static Integer getTrailingZeroCount(const Integer &NumberSourceSource) noexcept {
-            Integer NumberCount(0), NumberSource(NumberSourceSource);
-            while (NumberSource.isEven()) NumberSource = NumberSource.doDivision(2), NumberCount = NumberCount.doAddition(1);
-            return NumberCount;
+        static Integer getTrailingZeroCount(const Integer &NumberSource) noexcept {
+            return NumberSource.getTrailingZeroCount();
         }
 
         static bool isPrime(const Integer &NumberSource) noexcept {
@@ -267,7 +623,24 @@ namespace eLibrary {
             return isPrimeRabinMiller(NumberSource, {2}) && isPrimeLucas(NumberSource);
         }
 
+        template<size_t NumberBitCount, bool NumberSigned>
+        static constexpr bool isPrime(const FixedInteger<NumberBitCount, NumberSigned> &NumberSourceSigned) noexcept {
+            if (NumberSourceSigned.isNegative()) return false;
+            FixedInteger<NumberBitCount> NumberSource(NumberSourceSigned);
+            if (NumberSource.doCompare(2) < 0) return false;
+            for (uint64_t NumberPrime : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47}) {
+                if (!NumberSource.doCompare(NumberPrime)) return true;
+                if (!NumberSource.doModulo(NumberPrime).doCompare(0)) return false;
+            }
+            if (NumberSource.doCompare(2809) < 0) return true;
+            if (NumberSource.getBitLength() <= 64) return isPrimeRabinMiller(NumberSource, {2, 325, 9375, 28178, 450775, 9780504, 1795265022});
+            return isPrimeRabinMiller(NumberSource, {2}) && isPrimeLucas(NumberSource);
+        }
+
         static bool isPrimeLucas(const Integer &NumberSource) noexcept {
+            if (NumberSource.doCompare(3) < 0 || NumberSource.isEven()) return !NumberSource.doCompare(2);
+            if (NumberSource.isPerfectSquare()) return false;
+            Integer::ScratchScope NumberScope;
             Integer NumberD(5);
             for (;;) {
                 Integer NumberG(getGreatestCommonFactor(NumberD.getAbsolute(), NumberSource));
@@ -277,65 +650,97 @@ namespace eLibrary {
                 else NumberD = NumberD.getOpposite().doAddition(2);
             }
             if (!NumberD.doCompare(0)) return false;
-            Integer NumberIterationCount(0), NumberK(NumberSource.doAddition(1)), NumberP(1), NumberQ(Integer(1).doSubtraction(NumberD).doDivision(4));
-            while (NumberK.isEven()) NumberK = NumberK.doDivision(2), NumberIterationCount = NumberIterationCount.doAddition(1);
-            Integer NumberBitCount(NumberK.toString(2).getCharacterSize()), NumberQk(NumberQ), NumberU(1), NumberV(NumberP);
-            if (!NumberQ.doCompare(1)) {
-                while (NumberBitCount.doCompare(1) > 0) {
-                    NumberU = NumberU.doMultiplication(NumberV).doModulo(NumberSource);
-                    NumberV = NumberV.doMultiplication(NumberV).doSubtraction(2).doModulo(NumberSource);
-                    NumberBitCount = NumberBitCount.doSubtraction(1);
-                    if (NumberK.doDivision(Integer(2).doPower(NumberBitCount.doSubtraction(1))).isOdd()) {
-                        Integer NumberUBackup(NumberU.doMultiplication(NumberP).doAddition(NumberV));
-                        NumberV = NumberV.doMultiplication(NumberP).doAddition(NumberU.doMultiplication(NumberP));
-                        NumberU = NumberUBackup;
-                        if (NumberU.isOdd()) NumberU = NumberU.doAddition(NumberSource);
-                        if (NumberV.isOdd()) NumberV = NumberV.doAddition(NumberSource);
-                        NumberU = NumberU.doDivision(2);
-                        NumberV = NumberV.doDivision(2);
-                    }
+            Integer NumberK(NumberSource.doAddition(1));
+            size_t NumberIterationCount = NumberK.getTrailingZeroCount();
+            NumberK.doShiftRightAssign(NumberIterationCount);
+            MontgomeryContext NumberContext(NumberSource);
+            Integer NumberQSource(Integer(1).doSubtraction(NumberD).doDivision(4)), NumberQ(NumberContext.toMontgomery(NumberQSource));
+            Integer NumberOne(NumberContext.toMontgomery(1)), NumberQk(NumberQ), NumberU(NumberOne), NumberV(NumberOne), NumberW;
+            bool NumberQUnit = !NumberQSource.getAbsolute().doCompare(1);
+            for (size_t NumberBit = NumberK.getBitLength() - 1; NumberBit-- > 0;) {
+                NumberContext.doMultiplicationAssign(NumberU, NumberV);
+                NumberContext.doSubtractionAssign(NumberContext.doSubtractionAssign(NumberContext.doSquareAssign(NumberV), NumberQk), NumberQk);
+                if (NumberQUnit) NumberQk = NumberOne;
+                else NumberContext.doSquareAssign(NumberQk);
+                if (NumberK.isBitSet(NumberBit)) {
+                    NumberW = NumberD;
+                    NumberW.doMultiplicationModuloAssign(NumberU, NumberSource);
+                    if (NumberW.isNegative()) NumberW.doAdditionAssign(NumberSource);
+                    NumberContext.doAdditionAssign(NumberU, NumberV);
+                    NumberContext.doAdditionAssign(NumberV, NumberW);
+                    if (NumberU.isOdd()) NumberU.doAdditionAssign(NumberSource);
+                    if (NumberV.isOdd()) NumberV.doAdditionAssign(NumberSource);
+                    NumberU.doShiftRightAssign(1);
+                    NumberV.doShiftRightAssign(1);
+                    if (NumberQUnit) {
+                        if (NumberQSource.isNegative()) NumberQk = NumberSource.doSubtraction(NumberQk);
+                    } else NumberContext.doMultiplicationAssign(NumberQk, NumberQ);
                 }
-            } else if (!NumberP.doCompare(1) && !NumberQ.doCompare(-1)) {
-                while (NumberBitCount.doCompare(1) > 0) {
-                    NumberU = NumberU.doMultiplication(NumberV).doModulo(NumberSource);
-                    if (!NumberQk.doCompare(1)) NumberV = NumberV.doMultiplication(NumberV).doSubtraction(2).doModulo(NumberSource);
-                    else NumberV = NumberV.doMultiplication(NumberV).doAddition(2).doModulo(NumberSource), NumberQk = 1;
-                    NumberBitCount = NumberBitCount.doSubtraction(1);
-                    if (NumberK.doDivision(Integer(2).doPower(NumberBitCount.doSubtraction(1))).isOdd()) {
-                        Integer NumberUBackup(NumberU.doAddition(NumberV));
-                        NumberV = NumberV.doAddition(NumberU.doMultiplication(NumberD));
-                        NumberU = NumberUBackup;
-                        if (NumberU.isOdd()) NumberU = NumberU.doAddition(NumberSource);
-                        if (NumberV.isOdd()) NumberV = NumberV.doAddition(NumberSource);
-                        NumberU = NumberU.doDivision(2);
-                        NumberV = NumberV.doDivision(2);
-                        NumberQk = -1;
-                    }
-                }
-            } else while (NumberBitCount.doCompare(1) > 0) {
-                NumberU = NumberU.doMultiplication(NumberV).doModulo(NumberSource);
-                NumberV = NumberV.doMultiplication(NumberV).doSubtraction(NumberQk.doAddition(NumberQk)).doModulo(NumberSource);
-                NumberQk = NumberQk.doMultiplication(NumberQk);
-                NumberBitCount = NumberBitCount.doSubtraction(1);
-                if (NumberK.doDivision(Integer(2).doPower(NumberBitCount.doSubtraction(1))).isOdd()) {
-                    Integer NumberUBackup(NumberU.doAddition(NumberV));
-                    NumberV = NumberV.doAddition(NumberU.doMultiplication(NumberD));
-                    NumberU = NumberUBackup;
-                    if (NumberU.isOdd()) NumberU = NumberU.doAddition(NumberSource);
-                    if (NumberV.isOdd()) NumberV = NumberV.doAddition(NumberSource);
-                    NumberU = NumberU.doDivision(2);
-                    NumberV = NumberV.doDivision(2);
-                    NumberQk = NumberQk.doMultiplication(NumberQ);
+            }
+            if (!NumberU.doCompare(0) || !NumberV.doCompare(0)) return true;
+            for (size_t NumberIteration = 1; NumberIteration < NumberIterationCount; ++NumberIteration) {
+                NumberContext.doSubtractionAssign(NumberContext.doSubtractionAssign(NumberContext.doSquareAssign(NumberV), NumberQk), NumberQk);
+                if (!NumberV.doCompare(0)) return true;
+                NumberContext.doSquareAssign(NumberQk);
+            }
+            return false;
+        }
+
+        template<size_t NumberBitCount, bool NumberSigned>
+        static constexpr bool isPrimeLucas(const FixedInteger<NumberBitCount, NumberSigned> &NumberSourceSigned) noexcept {
+            FixedInteger<NumberBitCount> NumberSource(NumberSourceSigned);
+            if (NumberSourceSigned.isNegative() || NumberSource.doCompare(3) < 0 || NumberSource.isEven()) return !NumberSourceSigned.doCompare(2);
+            if (NumberSource.isPerfectSquare()) return false;
+            intmax_t NumberD = 5;
+            for (;; NumberD = NumberD > 0 ? -NumberD - 2 : 2 - NumberD) {
+                intmax_t NumberDAbsolute = NumberD > 0 ? NumberD : -NumberD, NumberJ = getJocabiSymbol(NumberSource.doModulo(NumberDAbsolute).getValue(), NumberDAbsolute);
+                if (NumberSource.isBitSet(1) && (NumberD < 0) != ((NumberDAbsolute & 3) == 3)) NumberJ = -NumberJ;
+                if (!NumberJ && NumberSource.doCompare(NumberDAbsolute)) return false;
+                if (NumberJ == -1) break;
+            }
+            auto doReduce = [&NumberSource](intmax_t NumberValue) {
+                FixedInteger<NumberBitCount> NumberResult(FixedInteger<NumberBitCount>((uintmax_t) (NumberValue < 0 ? -NumberValue : NumberValue)).doModulo(NumberSource));
+                if (NumberValue < 0 && NumberResult.doCompare(0)) NumberResult = NumberSource.doSubtraction(NumberResult);
+                return NumberResult;
+            };
+            auto doAdditionModulo = [&NumberSource](FixedInteger<NumberBitCount> &Number1, const FixedInteger<NumberBitCount> &Number2) {
+                FixedInteger<NumberBitCount> NumberRest(NumberSource.doSubtraction(Number2));
+                if (Number1.doCompare(NumberRest) >= 0) Number1.doSubtractionAssign(NumberRest);
+                else Number1.doAdditionAssign(Number2);
+            };
+            auto doSubtractionModulo = [&NumberSource](FixedInteger<NumberBitCount> &Number1, const FixedInteger<NumberBitCount> &Number2) {
+                bool NumberBorrow = Number1.doCompare(Number2) < 0;
+                Number1.doSubtractionAssign(Number2);
+                if (NumberBorrow) Number1.doAdditionAssign(NumberSource);
+            };
+            FixedInteger<NumberBitCount> NumberK(NumberSource.doAddition(1)), NumberHalf(NumberSource.doShiftRight(1).doAddition(1));
+            size_t NumberIterationCount = NumberK.doCompare(0) ? NumberK.getTrailingZeroCount() : NumberBitCount;
+            NumberK = NumberK.doCompare(0) ? NumberK.doShiftRight(NumberIterationCount) : FixedInteger<NumberBitCount>(1);
+            FixedInteger<NumberBitCount> NumberQ(doReduce((1 - NumberD) / 4)), NumberDModulo(doReduce(NumberD)), NumberQk(NumberQ), NumberU(1), NumberV(1), NumberW;
+            for (size_t NumberBit = NumberK.getBitLength() - 1; NumberBit-- > 0;) {
+                NumberU.doMultiplicationModuloAssign(NumberV, NumberSource);
+                NumberV.doMultiplicationModuloAssign(NumberV, NumberSource);
+                doSubtractionModulo(NumberV, NumberQk);
+                doSubtractionModulo(NumberV, NumberQk);
+                NumberQk.doMultiplicationModuloAssign(NumberQk, NumberSource);
+                if (NumberK.isBitSet(NumberBit)) {
+                    NumberW = NumberDModulo.doMultiplicationModulo(NumberU, NumberSource);
+                    doAdditionModulo(NumberU, NumberV);
+                    doAdditionModulo(NumberV, NumberW);
+                    if (NumberU.isOdd()) NumberU.doShiftRightAssign(1).doAdditionAssign(NumberHalf);
+                    else NumberU.doShiftRightAssign(1);
+                    if (NumberV.isOdd()) NumberV.doShiftRightAssign(1).doAdditionAssign(NumberHalf);
+                    else NumberV.doShiftRightAssign(1);
+                    NumberQk.doMultiplicationModuloAssign(NumberQ, NumberSource);
                 }
-                NumberQk = NumberQk.doModulo(NumberSource);
             }
-            NumberU = NumberU.doModulo(NumberSource);
-            NumberV = NumberV.doModulo(NumberSource);
             if (!NumberU.doCompare(0) || !NumberV.doCompare(0)) return true;
-            for (Integer NumberIteration = 1;NumberIteration.doCompare(NumberIterationCount) < 0;NumberIteration = NumberIteration.doAddition(1)) {
-                NumberV = NumberV.doMultiplication(NumberV).doSubtraction(NumberQk.doAddition(NumberQk)).doModulo(NumberSource);
+            for (size_t NumberIteration = 1; NumberIteration < NumberIterationCount; ++NumberIteration) {
+                NumberV.doMultiplicationModuloAssign(NumberV, NumberSource);
+                doSubtractionModulo(NumberV, NumberQk);
+                doSubtractionModulo(NumberV, NumberQk);
                 if (!NumberV.doCompare(0)) return true;
-                NumberQk = NumberQk.doPower(2, NumberSource);
+                NumberQk.doMultiplicationModuloAssign(NumberQk, NumberSource);
             }
             return false;
         }
@@ -351,26 +756,57 @@ namespace eLibrary {
         }
 
         static bool isPrimeRabinMiller(const Integer &NumberSource, const std::vector<Integer> &NumberBaseList) noexcept {
-            Integer NumberIteration(1), NumberExponent(NumberSource.doSubtraction(1));
-            while (NumberExponent.isEven()) NumberExponent = NumberExponent.doDivision(2), NumberIteration = NumberIteration.doAddition(1);
+            if (NumberSource.doCompare(3) < 0 || NumberSource.isEven()) return !NumberSource.doCompare(2);
+            Integer::ScratchScope NumberScope;
+            Integer NumberExponent(NumberSource.doSubtraction(1));
+            size_t NumberShift = NumberExponent.getTrailingZeroCount();
+            Integer NumberIteration(NumberShift + 1);
+            NumberExponent.doShiftRightAssign(NumberShift);
+            MontgomeryContext NumberContext(NumberSource);
             for (Integer NumberBase : NumberBaseList) {
-                if (NumberBase.doCompare(NumberSource) >= 0) NumberBase = NumberBase.doModulo(NumberSource);
-                if (NumberBase.doCompare(2) >= 0 && !isPrimeRabinMiller(NumberSource, NumberBase, NumberExponent, NumberIteration)) return false;
+                if (NumberBase.doCompare(NumberSource) >= 0) NumberBase.doModuloAssign(NumberSource);
+                if (NumberBase.doCompare(2) >= 0 && !isPrimeRabinMiller(NumberContext, NumberBase, NumberExponent, NumberIteration)) return false;
             }
             return true;
         }
 
         static bool isPrimeRabinMiller(const Integer &NumberSource, const Integer &NumberBase, const Integer &NumberExponent, const Integer &NumberIterationCount) noexcept {
-            Integer NumberPower(NumberBase.doPower(NumberExponent, NumberSource));
-            if (!NumberPower.doCompare(1) || !NumberPower.doCompare(NumberSource.doSubtraction(1))) return true;
-            for (Integer NumberIteration = 0;NumberIteration.doCompare(NumberIterationCount) < 0;NumberIteration = NumberIteration.doAddition(1)) {
-                NumberPower = NumberPower.doPower(2, NumberSource);
-                if (!NumberPower.doCompare(NumberSource.doSubtraction(1))) return true;
-                if (!NumberPower.doCompare(1)) return false;
+            return isPrimeRabinMiller(MontgomeryContext(NumberSource), NumberBase, NumberExponent, NumberIterationCount);
+        }
+
+        static bool isPrimeRabinMiller(const MontgomeryContext &NumberContext, const Integer &NumberBase, const Integer &NumberExponent, const Integer &NumberIterationCount) noexcept {
+            Integer NumberPower(NumberContext.doPower(NumberContext.toMontgomery(NumberBase), NumberExponent)), NumberOne(NumberContext.toMontgomery(1)), NumberSourceDecrement(NumberContext.getModulo().doSubtraction(NumberOne));
+            if (!NumberPower.doCompare(NumberOne) || !NumberPower.doCompare(NumberSourceDecrement)) return true;
+            for (Integer NumberIteration = 0;NumberIteration.doCompare(NumberIterationCount) < 0;NumberIteration.doAdditionAssign(1)) {
+                NumberContext.doSquareAssign(NumberPower);
+                if (!NumberPower.doCompare(NumberSourceDecrement)) return true;
+                if (!NumberPower.doCompare(NumberOne)) return false;
             }
             return false;
         }
 
+        template<size_t NumberBitCount, bool NumberSigned>
+        static constexpr bool isPrimeRabinMiller(const FixedInteger<NumberBitCount, NumberSigned> &NumberSourceSigned, std::initializer_list<uint64_t> NumberBaseList) noexcept {
+            FixedInteger<NumberBitCount> NumberSource(NumberSourceSigned);
+            if (NumberSourceSigned.isNegative() || NumberSource.doCompare(3) < 0 || NumberSource.isEven()) return !NumberSourceSigned.doCompare(2);
+            FixedInteger<NumberBitCount> NumberSourceDecrement(NumberSource.doSubtraction(1)), NumberExponent(NumberSourceDecrement);
+            size_t NumberShift = NumberExponent.getTrailingZeroCount();
+            NumberExponent.doShiftRightAssign(NumberShift);
+            for (uint64_t NumberBase : NumberBaseList) {
+                FixedInteger<NumberBitCount> NumberPower(FixedInteger<NumberBitCount>(NumberBase).doModulo(NumberSource));
+                if (NumberPower.doCompare(2) < 0) continue;
+                NumberPower = NumberPower.doPower(NumberExponent, NumberSource);
+                if (!NumberPower.doCompare(1) || !NumberPower.doCompare(NumberSourceDecrement)) continue;
+                size_t NumberIteration = 1;
+                for (; NumberIteration < NumberShift; ++NumberIteration) {
+                    NumberPower.doMultiplicationModuloAssign(NumberPower, NumberSource);
+                    if (!NumberPower.doCompare(NumberSourceDecrement) || !NumberPower.doCompare(1)) break;
+                }
+                if (NumberIteration == NumberShift || NumberPower.doCompare(NumberSourceDecrement)) return false;
+            }
+            return true;
+        }
+
         template<typename T> requires std::is_arithmetic<T>::value
         static T toDegrees(T NumberSource) noexcept {
             return 180.0 / std::numbers::pi * NumberSource;
@@ -3,368 +3,3205 @@
 #include <Core/Exception.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
 #include <cstdlib>
-#include <deque>
-#include <iomanip>
-#include <map>
+#include <limits>
 #include <numbers>
 #include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 namespace eLibrary {
-#define NumberBaseUnit 10000000
+    class Integer final : public Object {
+    private:
+        class LimbArena final {
+        public:
+            static constexpr size_t NumberChunkCapacity = 8192;
+
+            struct LimbChunk final {
+                std::atomic<LimbArena*> NumberArena;
+                std::atomic<size_t> NumberReference;
+                LimbChunk *NumberNext;
+                size_t NumberOffset;
+                uint64_t NumberData[NumberChunkCapacity];
+            };
+        private:
+            static constexpr size_t NumberCacheCapacity = 4;
+
+            LimbChunk *NumberActive = nullptr, *NumberCache = nullptr;
+            size_t NumberCacheSize = 0, NumberDepth = 0;
+
+            static LimbArena &getInstance() noexcept {
+                thread_local LimbArena NumberInstance;
+                return NumberInstance;
+            }
+
+            void doRelease(LimbChunk *NumberChunk) noexcept {
+                if (NumberChunk->NumberReference.load(std::memory_order_acquire) == 1 && NumberCacheSize < NumberCacheCapacity) {
+                    NumberChunk->NumberOffset = 0;
+                    NumberChunk->NumberNext = NumberCache;
+                    NumberCache = NumberChunk;
+                    ++NumberCacheSize;
+                    return;
+                }
+                NumberChunk->NumberArena.store(nullptr, std::memory_order_relaxed);
+                if (NumberChunk->NumberReference.fetch_sub(1, std::memory_order_acq_rel) == 1) delete NumberChunk;
+            }
+        public:
+            LimbArena() noexcept = default;
+
+            LimbArena(const LimbArena&) = delete;
+
+            ~LimbArena() noexcept {
+                while (NumberActive) {
+                    LimbChunk *NumberChunk = NumberActive;
+                    NumberActive = NumberChunk->NumberNext;
+                    doRelease(NumberChunk);
+                }
+                while (NumberCache) {
+                    LimbChunk *NumberChunk = NumberCache;
+                    NumberCache = NumberChunk->NumberNext;
+                    delete NumberChunk;
+                }
+            }
+
+            static uint64_t *doAllocate(size_t NumberCapacity, bool NumberScratch = false) {
+                LimbArena &NumberInstance = getInstance();
+                if ((!NumberScratch && !NumberInstance.NumberDepth) || NumberCapacity >= NumberChunkCapacity >> 1) {
+                    auto *NumberContainer = new uint64_t[NumberCapacity + 1];
+                    NumberContainer[0] = 0;
+                    return NumberContainer + 1;
+                }
+                LimbChunk *NumberChunk = NumberInstance.NumberActive;
+                if (!NumberChunk || NumberChunk->NumberOffset + NumberCapacity + 1 > NumberChunkCapacity) {
+                    if (NumberInstance.NumberCache) {
+                        NumberChunk = NumberInstance.NumberCache;
+                        NumberInstance.NumberCache = NumberChunk->NumberNext;
+                        --NumberInstance.NumberCacheSize;
+                    } else NumberChunk = new LimbChunk;
+                    NumberChunk->NumberArena.store(&NumberInstance, std::memory_order_relaxed);
+                    NumberChunk->NumberReference.store(1, std::memory_order_relaxed);
+                    NumberChunk->NumberNext = NumberInstance.NumberActive;
+                    NumberChunk->NumberOffset = 0;
+                    NumberInstance.NumberActive = NumberChunk;
+                }
+                uint64_t *NumberContainer = NumberChunk->NumberData + NumberChunk->NumberOffset;
+                NumberContainer[0] = (uint64_t) (uintptr_t) NumberChunk;
+                NumberChunk->NumberOffset += NumberCapacity + 1;
+                NumberChunk->NumberReference.fetch_add(1, std::memory_order_relaxed);
+                return NumberContainer + 1;
+            }
+
+            static void doDeallocate(uint64_t *NumberContainer, size_t NumberCapacity) noexcept {
+                auto *NumberChunk = (LimbChunk*) (uintptr_t) NumberContainer[-1];
+                if (!NumberChunk) {
+                    delete[] (NumberContainer - 1);
+                    return;
+                }
+                LimbArena *NumberInstance = NumberChunk->NumberArena.load(std::memory_order_relaxed);
+                bool NumberEmpty = false;
+                if (NumberInstance == &getInstance() && NumberChunk->NumberData + NumberChunk->NumberOffset == NumberContainer + NumberCapacity) {
+                    NumberChunk->NumberOffset -= NumberCapacity + 1;
+                    NumberEmpty = !NumberChunk->NumberOffset && NumberChunk == NumberInstance->NumberActive && NumberChunk->NumberNext;
+                }
+                if (NumberChunk->NumberReference.fetch_sub(1, std::memory_order_acq_rel) == 1) delete NumberChunk;
+                else if (NumberEmpty) {
+                    NumberInstance->NumberActive = NumberChunk->NumberNext;
+                    NumberInstance->doRelease(NumberChunk);
+                }
+            }
+
+            static LimbChunk *doEnter() noexcept {
+                LimbArena &NumberInstance = getInstance();
+                LimbChunk *NumberPrevious = NumberInstance.NumberActive;
+                NumberInstance.NumberActive = nullptr;
+                ++NumberInstance.NumberDepth;
+                return NumberPrevious;
+            }
+
+            static void doLeave(LimbChunk *NumberPrevious) noexcept {
+                LimbArena &NumberInstance = getInstance();
+                while (NumberInstance.NumberActive) {
+                    LimbChunk *NumberChunk = NumberInstance.NumberActive;
+                    NumberInstance.NumberActive = NumberChunk->NumberNext;
+                    NumberInstance.doRelease(NumberChunk);
+                }
+                NumberInstance.NumberActive = NumberPrevious;
+                if (NumberInstance.NumberDepth) --NumberInstance.NumberDepth;
+            }
+
+            LimbArena &operator=(const LimbArena&) = delete;
+        };
+
+        class LimbStorage final {
+        private:
+            static constexpr size_t NumberInlineCapacity = 2;
+
+            uint64_t *NumberContainer;
+            size_t NumberCapacity, NumberSize;
+            uint64_t NumberInline[NumberInlineCapacity];
+
+            void doReserve(size_t NumberCapacityTarget) {
+                if (NumberCapacityTarget <= NumberCapacity) return;
+                NumberCapacityTarget = std::max(NumberCapacityTarget, NumberCapacity << 1);
+                uint64_t *NumberContainerTarget = LimbArena::doAllocate(NumberCapacityTarget);
+                std::copy(NumberContainer, NumberContainer + NumberSize, NumberContainerTarget);
+                if (NumberContainer != NumberInline) LimbArena::doDeallocate(NumberContainer, NumberCapacity);
+                NumberContainer = NumberContainerTarget;
+                NumberCapacity = NumberCapacityTarget;
+            }
+        public:
+            LimbStorage() noexcept : NumberContainer(NumberInline), NumberCapacity(NumberInlineCapacity), NumberSize(0), NumberInline{} {}
+
+            explicit LimbStorage(size_t NumberSizeSource, bool NumberScratch = false) : LimbStorage() {
+                if (NumberScratch && NumberSizeSource > NumberCapacity) {
+                    NumberContainer = LimbArena::doAllocate(NumberSizeSource, true);
+                    NumberCapacity = NumberSizeSource;
+                }
+                resize(NumberSizeSource);
+            }
+
+            LimbStorage(const uint64_t *NumberBegin, const uint64_t *NumberEnd) : LimbStorage() {
+                assign(NumberBegin, NumberEnd);
+            }
+
+            LimbStorage(const LimbStorage &NumberSource) : LimbStorage() {
+                assign(NumberSource.begin(), NumberSource.end());
+            }
+
+            LimbStorage(LimbStorage &&NumberSource) noexcept : LimbStorage() {
+                swap(NumberSource);
+            }
+
+            ~LimbStorage() noexcept {
+                if (NumberContainer != NumberInline) LimbArena::doDeallocate(NumberContainer, NumberCapacity);
+            }
+
+            void assign(size_t NumberSizeSource, uint64_t NumberValue) {
+                NumberSize = 0;
+                doReserve(NumberSizeSource);
+                std::fill(NumberContainer, NumberContainer + NumberSizeSource, NumberValue);
+                NumberSize = NumberSizeSource;
+            }
+
+            void assign(const uint64_t *NumberBegin, const uint64_t *NumberEnd) {
+                auto NumberSizeSource = (size_t) (NumberEnd - NumberBegin);
+                if (NumberSizeSource > NumberCapacity) {
+                    uint64_t *NumberContainerTarget = LimbArena::doAllocate(NumberSizeSource);
+                    std::copy(NumberBegin, NumberEnd, NumberContainerTarget);
+                    if (NumberContainer != NumberInline) LimbArena::doDeallocate(NumberContainer, NumberCapacity);
+                    NumberContainer = NumberContainerTarget;
+                    NumberCapacity = NumberSizeSource;
+                } else std::copy(NumberBegin, NumberEnd, NumberContainer);
+                NumberSize = NumberSizeSource;
+            }
+
+            uint64_t &back() noexcept {
+                return NumberContainer[NumberSize - 1];
+            }
+
+            const uint64_t &back() const noexcept {
+                return NumberContainer[NumberSize - 1];
+            }
+
+            uint64_t *begin() noexcept {
+                return NumberContainer;
+            }
+
+            const uint64_t *begin() const noexcept {
+                return NumberContainer;
+            }
+
+            void clear() noexcept {
+                NumberSize = 0;
+            }
+
+            uint64_t *data() noexcept {
+                return NumberContainer;
+            }
+
+            const uint64_t *data() const noexcept {
+                return NumberContainer;
+            }
+
+            bool empty() const noexcept {
+                return !NumberSize;
+            }
+
+            uint64_t *end() noexcept {
+                return NumberContainer + NumberSize;
+            }
+
+            const uint64_t *end() const noexcept {
+                return NumberContainer + NumberSize;
+            }
+
+            void pop_back() noexcept {
+                --NumberSize;
+            }
+
+            void push_back(uint64_t NumberValue) {
+                doReserve(NumberSize + 1);
+                NumberContainer[NumberSize++] = NumberValue;
+            }
+
+            void resize(size_t NumberSizeTarget) {
+                doReserve(NumberSizeTarget);
+                if (NumberSizeTarget > NumberSize) std::fill(NumberContainer + NumberSize, NumberContainer + NumberSizeTarget, 0);
+                NumberSize = NumberSizeTarget;
+            }
+
+            size_t size() const noexcept {
+                return NumberSize;
+            }
+
+            void swap(LimbStorage &NumberOther) noexcept {
+                bool NumberInline1 = NumberContainer == NumberInline, NumberInline2 = NumberOther.NumberContainer == NumberOther.NumberInline;
+                std::swap(NumberContainer, NumberOther.NumberContainer);
+                std::swap(NumberCapacity, NumberOther.NumberCapacity);
+                std::swap(NumberSize, NumberOther.NumberSize);
+                std::swap(NumberInline, NumberOther.NumberInline);
+                if (NumberInline1) NumberOther.NumberContainer = NumberOther.NumberInline;
+                if (NumberInline2) NumberContainer = NumberInline;
+            }
+
+            LimbStorage &operator=(const LimbStorage &NumberSource) {
+                if (&NumberSource != this) assign(NumberSource.begin(), NumberSource.end());
+                return *this;
+            }
+
+            LimbStorage &operator=(LimbStorage &&NumberSource) noexcept {
+                if (&NumberSource != this) {
+                    LimbStorage NumberExpired(std::move(NumberSource));
+                    swap(NumberExpired);
+                }
+                return *this;
+            }
+
+            uint64_t &operator[](size_t NumberIndex) noexcept {
+                return NumberContainer[NumberIndex];
+            }
+
+            const uint64_t &operator[](size_t NumberIndex) const noexcept {
+                return NumberContainer[NumberIndex];
+            }
+        };
+
+        bool NumberSignature;
+        LimbStorage NumberList;
+
+        friend class BigFloat;
+        template<size_t, bool> friend class FixedInteger;
+        friend class Fraction;
+        friend class IntegerAccumulator;
+        friend class MontgomeryContext;
+
+        static constexpr size_t NumberBurnikelZieglerThreshold = 64;
+        static constexpr size_t NumberConversionThreshold = 32;
+        static constexpr char16_t NumberDigitTable[] = u"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        static constexpr unsigned short NumberInstructionAVX2 = 1;
+        static constexpr unsigned short NumberInstructionAVX512 = 2;
+        static constexpr size_t NumberKaratsubaThreshold = 32;
+        static constexpr size_t NumberNTTThreshold = 3072;
+        static inline std::atomic<intmax_t> NumberParallelAvailable = 0;
+        static inline std::atomic<size_t> NumberParallelCount = 1;
+        static inline std::atomic<size_t> NumberParallelThreshold = 1024;
+        static constexpr size_t NumberToom3Threshold = 256;
+        static constexpr size_t NumberVectorThreshold = 16;
+
+        static unsigned short getInstructionSet() noexcept {
+#if defined(__x86_64__)
+            __builtin_cpu_init();
+            return (__builtin_cpu_supports("avx2") ? NumberInstructionAVX2 : 0) | (__builtin_cpu_supports("avx512f") ? NumberInstructionAVX512 : 0);
+#else
+            return 0;
+#endif
+        }
+
+        static inline const unsigned short NumberInstructionSet = getInstructionSet();
+
+        Integer(const uint64_t *NumberSource, size_t NumberSize) noexcept : NumberSignature(true), NumberList(NumberSource, NumberSource + NumberSize) {
+            doNormalize();
+        }
+
+        static constexpr uint64_t getInverseLimb(uint64_t NumberSource) noexcept {
+            uint64_t NumberInverse = NumberSource;
+            for (unsigned short NumberIteration = 0; NumberIteration < 5; ++NumberIteration) NumberInverse *= 2 - NumberSource * NumberInverse;
+            return NumberInverse;
+        }
+
+        static constexpr uint64_t getPowerModulo(uint64_t NumberBase, uint64_t NumberExponent, uint64_t NumberModulo) noexcept {
+            uint64_t NumberResult = 1;
+            for (; NumberExponent; NumberExponent >>= 1) {
+                if (NumberExponent & 1) NumberResult = (uint64_t) ((unsigned __int128) NumberResult * NumberBase % NumberModulo);
+                NumberBase = (uint64_t) ((unsigned __int128) NumberBase * NumberBase % NumberModulo);
+            }
+            return NumberResult;
+        }
+
+        static constexpr uint64_t getReciprocalLimb(uint64_t NumberDivisor) noexcept {
+            return (uint64_t) (((unsigned __int128) ~NumberDivisor << 64 | ~(uint64_t) 0) / NumberDivisor);
+        }
+
+        static uint64_t doAdditionKernel(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            uint64_t NumberCarry = 0;
+            size_t NumberPart = 0;
+#if defined(__x86_64__)
+            if (NumberSize2 >= NumberVectorThreshold && NumberInstructionSet) {
+                NumberPart = NumberSize2 & ~(size_t) 7;
+                NumberCarry = NumberInstructionSet & NumberInstructionAVX512 ? doAdditionKernelAVX512(NumberTarget, NumberSource1, NumberSource2, NumberPart) : doAdditionKernelAVX2(NumberTarget, NumberSource1, NumberSource2, NumberPart);
+            }
+#endif
+            for (; NumberPart < NumberSize2; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource1[NumberPart] + NumberSource2[NumberPart] + NumberCarry;
+                NumberTarget[NumberPart] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+            for (; NumberPart < NumberSize1; ++NumberPart) {
+                NumberTarget[NumberPart] = NumberSource1[NumberPart] + NumberCarry;
+                NumberCarry = NumberTarget[NumberPart] < NumberCarry;
+            }
+            return NumberCarry;
+        }
+
+#if defined(__x86_64__)
+        __attribute__((target("avx2")))
+        static uint64_t doAdditionKernelAVX2(uint64_t *NumberTarget, const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            const __m256i NumberBias = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min()), NumberMaximum = _mm256_set1_epi64x(-1), NumberLane = _mm256_setr_epi64x(1, 2, 4, 8);
+            unsigned NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; NumberPart += 4) {
+                __m256i Number1 = _mm256_loadu_si256((const __m256i*) (NumberSource1 + NumberPart)), Number2 = _mm256_loadu_si256((const __m256i*) (NumberSource2 + NumberPart)), NumberSummation = _mm256_add_epi64(Number1, Number2);
+                auto NumberGenerate = (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(Number1, NumberBias), _mm256_xor_si256(NumberSummation, NumberBias))));
+                auto NumberPropagate = (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(NumberSummation, NumberMaximum)));
+                unsigned NumberLookahead = (NumberGenerate << 1 | NumberCarry) + NumberPropagate;
+                NumberCarry = NumberLookahead >> 4;
+                __m256i NumberMask = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x((NumberLookahead ^ NumberPropagate) & 15), NumberLane), NumberLane);
+                _mm256_storeu_si256((__m256i*) (NumberTarget + NumberPart), _mm256_sub_epi64(NumberSummation, NumberMask));
+            }
+            return NumberCarry;
+        }
+
+        __attribute__((target("avx512f")))
+        static uint64_t doAdditionKernelAVX512(uint64_t *NumberTarget, const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            const __m512i NumberMaximum = _mm512_set1_epi64(-1);
+            unsigned NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; NumberPart += 8) {
+                __m512i Number1 = _mm512_loadu_si512(NumberSource1 + NumberPart), NumberSummation = _mm512_add_epi64(Number1, _mm512_loadu_si512(NumberSource2 + NumberPart));
+                unsigned NumberPropagate = _mm512_cmpeq_epi64_mask(NumberSummation, NumberMaximum), NumberLookahead = ((unsigned) _mm512_cmplt_epu64_mask(NumberSummation, Number1) << 1 | NumberCarry) + NumberPropagate;
+                NumberCarry = NumberLookahead >> 8;
+                _mm512_storeu_si512(NumberTarget + NumberPart, _mm512_mask_sub_epi64(NumberSummation, (__mmask8) (NumberLookahead ^ NumberPropagate), NumberSummation, NumberMaximum));
+            }
+            return NumberCarry;
+        }
+#endif
+
+        static intmax_t doCompareKernel(const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            if (NumberSize1 != NumberSize2) return NumberSize1 > NumberSize2 ? 1 : -1;
+#if defined(__x86_64__)
+            if (NumberSize1 >= NumberVectorThreshold && NumberInstructionSet) NumberSize1 = NumberInstructionSet & NumberInstructionAVX512 ? doCompareKernelAVX512(NumberSource1, NumberSource2, NumberSize1) : doCompareKernelAVX2(NumberSource1, NumberSource2, NumberSize1);
+#endif
+            for (size_t NumberPart = NumberSize1; NumberPart-- > 0;)
+                if (NumberSource1[NumberPart] != NumberSource2[NumberPart])
+                    return NumberSource1[NumberPart] > NumberSource2[NumberPart] ? 1 : -1;
+            return 0;
+        }
+
+#if defined(__x86_64__)
+        __attribute__((target("avx2")))
+        static size_t doCompareKernelAVX2(const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            for (; NumberSize >= 4; NumberSize -= 4)
+                if (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) (NumberSource1 + NumberSize - 4)), _mm256_loadu_si256((const __m256i*) (NumberSource2 + NumberSize - 4))))) != 15) break;
+            return NumberSize;
+        }
+
+        __attribute__((target("avx512f")))
+        static size_t doCompareKernelAVX512(const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            for (; NumberSize >= 8; NumberSize -= 8)
+                if (_mm512_cmpneq_epu64_mask(_mm512_loadu_si512(NumberSource1 + NumberSize - 8), _mm512_loadu_si512(NumberSource2 + NumberSize - 8))) break;
+            return NumberSize;
+        }
+#endif
+
+        static void doDivisionKnuthKernel(uint64_t *NumberQuotient, uint64_t *NumberRemainder, size_t NumberSizeDividend, const uint64_t *NumberDivisor, size_t NumberSizeDivisor) noexcept {
+            uint64_t NumberDivisorHigh = NumberDivisor[NumberSizeDivisor - 1], NumberDivisorLow = NumberDivisor[NumberSizeDivisor - 2], NumberReciprocal = getReciprocalLimb(NumberDivisorHigh);
+            for (size_t NumberPart = NumberSizeDividend - NumberSizeDivisor + 1; NumberPart-- > 0;) {
+                uint64_t *NumberWindow = NumberRemainder + NumberPart, NumberEstimate, NumberEstimateRemainder;
+                bool NumberOverflow = false;
+                if (NumberWindow[NumberSizeDivisor] >= NumberDivisorHigh) {
+                    NumberEstimate = std::numeric_limits<uint64_t>::max();
+                    NumberEstimateRemainder = NumberWindow[NumberSizeDivisor - 1] + NumberDivisorHigh;
+                    NumberOverflow = NumberEstimateRemainder < NumberDivisorHigh;
+                } else NumberEstimate = doDivisionReciprocal(NumberWindow[NumberSizeDivisor], NumberWindow[NumberSizeDivisor - 1], NumberDivisorHigh, NumberReciprocal, NumberEstimateRemainder);
+                while (!NumberOverflow && (unsigned __int128) NumberEstimate * NumberDivisorLow > ((unsigned __int128) NumberEstimateRemainder << 64 | NumberWindow[NumberSizeDivisor - 2])) {
+                    --NumberEstimate;
+                    NumberEstimateRemainder += NumberDivisorHigh;
+                    NumberOverflow = NumberEstimateRemainder < NumberDivisorHigh;
+                }
+                uint64_t NumberBorrow = doMultiplicationSubtractionKernel(NumberWindow, NumberDivisor, NumberSizeDivisor, NumberEstimate);
+                if (NumberWindow[NumberSizeDivisor] < NumberBorrow) {
+                    --NumberEstimate;
+                    NumberWindow[NumberSizeDivisor] += doAdditionKernel(NumberWindow, NumberWindow, NumberSizeDivisor, NumberDivisor, NumberSizeDivisor);
+                }
+                NumberWindow[NumberSizeDivisor] -= NumberBorrow;
+                NumberQuotient[NumberPart] = NumberEstimate;
+            }
+        }
+
+        static constexpr uint64_t doDivisionLimbKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, uint64_t NumberDivisor) noexcept {
+            if (!NumberSize) return 0;
+            unsigned short NumberShift = std::countl_zero(NumberDivisor);
+            NumberDivisor <<= NumberShift;
+            uint64_t NumberReciprocal = getReciprocalLimb(NumberDivisor), NumberRemainder = NumberShift ? NumberSource[NumberSize - 1] >> (64 - NumberShift) : 0;
+            for (size_t NumberPart = NumberSize; NumberPart-- > 0;)
+                NumberTarget[NumberPart] = doDivisionReciprocal(NumberRemainder, NumberShift ? NumberSource[NumberPart] << NumberShift | (NumberPart ? NumberSource[NumberPart - 1] >> (64 - NumberShift) : 0) : NumberSource[NumberPart], NumberDivisor, NumberReciprocal, NumberRemainder);
+            return NumberRemainder >> NumberShift;
+        }
+
+        static constexpr uint64_t doDivisionReciprocal(uint64_t NumberHigh, uint64_t NumberLow, uint64_t NumberDivisor, uint64_t NumberReciprocal, uint64_t &NumberRemainder) noexcept {
+            unsigned __int128 NumberQuotient = (unsigned __int128) NumberReciprocal * NumberHigh + ((unsigned __int128) (NumberHigh + 1) << 64 | NumberLow);
+            auto NumberQuotientHigh = (uint64_t) (NumberQuotient >> 64);
+            NumberRemainder = NumberLow - NumberQuotientHigh * NumberDivisor;
+            if (NumberRemainder > (uint64_t) NumberQuotient) {
+                --NumberQuotientHigh;
+                NumberRemainder += NumberDivisor;
+            }
+            if (NumberRemainder >= NumberDivisor) {
+                ++NumberQuotientHigh;
+                NumberRemainder -= NumberDivisor;
+            }
+            return NumberQuotientHigh;
+        }
+
+        static uint64_t doMultiplicationAdditionKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, uint64_t NumberMultiplier) noexcept {
+            uint64_t NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource[NumberPart] * NumberMultiplier + NumberTarget[NumberPart] + NumberCarry;
+                NumberTarget[NumberPart] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+            return NumberCarry;
+        }
+
+        static void doMultiplicationKaratsuba(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            size_t NumberSizeHalf = (NumberSize1 + 1) >> 1, NumberSizeProduct = NumberSize1 + NumberSize2;
+            LimbStorage NumberBuffer((NumberSizeHalf + 1) << 2, true);
+            uint64_t *NumberSummation1 = NumberBuffer.data(), *NumberSummation2 = NumberSummation1 + NumberSizeHalf + 1, *NumberMiddle = NumberSummation2 + NumberSizeHalf + 1;
+            NumberSummation1[NumberSizeHalf] = doAdditionKernel(NumberSummation1, NumberSource1, NumberSizeHalf, NumberSource1 + NumberSizeHalf, NumberSize1 - NumberSizeHalf);
+            NumberSummation2[NumberSizeHalf] = doAdditionKernel(NumberSummation2, NumberSource2, NumberSizeHalf, NumberSource2 + NumberSizeHalf, NumberSize2 - NumberSizeHalf);
+            doParallelTask(NumberSize2, [&] {
+                doMultiplicationKernel(NumberMiddle, NumberSummation1, NumberSizeHalf + 1, NumberSummation2, NumberSizeHalf + 1);
+            }, [&] {
+                doMultiplicationKernel(NumberTarget, NumberSource1, NumberSizeHalf, NumberSource2, NumberSizeHalf);
+            }, [&] {
+                doMultiplicationKernel(NumberTarget + (NumberSizeHalf << 1), NumberSource1 + NumberSizeHalf, NumberSize1 - NumberSizeHalf, NumberSource2 + NumberSizeHalf, NumberSize2 - NumberSizeHalf);
+            });
+            doSubtractionKernel(NumberMiddle, NumberMiddle, (NumberSizeHalf + 1) << 1, NumberTarget, NumberSizeHalf << 1);
+            doSubtractionKernel(NumberMiddle, NumberMiddle, (NumberSizeHalf + 1) << 1, NumberTarget + (NumberSizeHalf << 1), NumberSizeProduct - (NumberSizeHalf << 1));
+            doAdditionKernel(NumberTarget + NumberSizeHalf, NumberTarget + NumberSizeHalf, NumberSizeProduct - NumberSizeHalf, NumberMiddle, std::min((NumberSizeHalf + 1) << 1, NumberSizeProduct - NumberSizeHalf));
+        }
+
+        static void doMultiplicationKernel(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            if (NumberSize1 < NumberSize2) {
+                std::swap(NumberSource1, NumberSource2);
+                std::swap(NumberSize1, NumberSize2);
+            }
+            if (NumberSize2 < NumberKaratsubaThreshold) {
+                if (NumberSource1 == NumberSource2 && NumberSize1 == NumberSize2) doSquareSchoolbook(NumberTarget, NumberSource1, NumberSize1);
+                else doMultiplicationSchoolbook(NumberTarget, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            }
+            else if (NumberSize2 >= NumberNTTThreshold) doMultiplicationNTT(NumberTarget, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            else if (NumberSize2 <= (NumberSize1 + 1) >> 1) doMultiplicationUnbalanced(NumberTarget, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            else if (NumberSize2 < NumberToom3Threshold || NumberSize2 <= (NumberSize1 + 2) / 3 * 2) doMultiplicationKaratsuba(NumberTarget, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            else doMultiplicationToom3(NumberTarget, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+        }
+
+        static uint64_t doMultiplicationLimbKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, uint64_t NumberMultiplier) noexcept {
+            uint64_t NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource[NumberPart] * NumberMultiplier + NumberCarry;
+                NumberTarget[NumberPart] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+            return NumberCarry;
+        }
+
+        static void doMultiplicationNTT(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            constexpr uint64_t NumberModulo1 = 0x3FFFC00000000001, NumberModulo2 = 0x3FFFBE0000000001, NumberModulo3 = 0x3FFF840000000001;
+            constexpr uint64_t NumberInverse2 = -getInverseLimb(NumberModulo2), NumberInverse3 = -getInverseLimb(NumberModulo3);
+            constexpr uint64_t NumberFactor12 = (uint64_t) (((unsigned __int128) getPowerModulo(NumberModulo1 % NumberModulo2, NumberModulo2 - 2, NumberModulo2) << 64) % NumberModulo2);
+            constexpr uint64_t NumberFactor13 = (uint64_t) (((unsigned __int128) (NumberModulo1 % NumberModulo3) << 64) % NumberModulo3);
+            constexpr uint64_t NumberFactor123 = (uint64_t) (((unsigned __int128) getPowerModulo((uint64_t) ((unsigned __int128) NumberModulo1 * NumberModulo2 % NumberModulo3), NumberModulo3 - 2, NumberModulo3) << 64) % NumberModulo3);
+            constexpr unsigned __int128 NumberModulo12 = (unsigned __int128) NumberModulo1 * NumberModulo2;
+            size_t NumberSizeProduct = NumberSize1 + NumberSize2, NumberSizeTransform = 1;
+            while (NumberSizeTransform < NumberSizeProduct - 1) NumberSizeTransform <<= 1;
+            std::vector<uint64_t> NumberResidue(NumberSizeTransform * 3);
+            doParallelTask(NumberSize2, [&] {
+                doMultiplicationNTTPrime<NumberModulo1, 11>(NumberResidue.data(), NumberSizeTransform, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            }, [&] {
+                doMultiplicationNTTPrime<NumberModulo2, 3>(NumberResidue.data() + NumberSizeTransform, NumberSizeTransform, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            }, [&] {
+                doMultiplicationNTTPrime<NumberModulo3, 19>(NumberResidue.data() + (NumberSizeTransform << 1), NumberSizeTransform, NumberSource1, NumberSize1, NumberSource2, NumberSize2);
+            });
+            uint64_t NumberCarry[3] = {0, 0, 0};
+            for (size_t NumberPart = 0; NumberPart < NumberSizeProduct; ++NumberPart) {
+                if (NumberPart + 1 < NumberSizeProduct) {
+                    uint64_t NumberResidue1 = NumberResidue[NumberPart], NumberResidue2 = NumberResidue[NumberPart + NumberSizeTransform], NumberResidue3 = NumberResidue[NumberPart + (NumberSizeTransform << 1)];
+                    uint64_t NumberResidue12 = NumberResidue1 >= NumberModulo2 ? NumberResidue1 - NumberModulo2 : NumberResidue1;
+                    uint64_t NumberDigit2 = doReductionMontgomery((unsigned __int128) (NumberResidue2 >= NumberResidue12 ? NumberResidue2 - NumberResidue12 : NumberResidue2 + NumberModulo2 - NumberResidue12) * NumberFactor12, NumberModulo2, NumberInverse2);
+                    uint64_t NumberResidue13 = NumberResidue1 >= NumberModulo3 ? NumberResidue1 - NumberModulo3 : NumberResidue1;
+                    NumberResidue13 += doReductionMontgomery((unsigned __int128) NumberDigit2 * NumberFactor13, NumberModulo3, NumberInverse3);
+                    if (NumberResidue13 >= NumberModulo3) NumberResidue13 -= NumberModulo3;
+                    uint64_t NumberDigit3 = doReductionMontgomery((unsigned __int128) (NumberResidue3 >= NumberResidue13 ? NumberResidue3 - NumberResidue13 : NumberResidue3 + NumberModulo3 - NumberResidue13) * NumberFactor123, NumberModulo3, NumberInverse3);
+                    unsigned __int128 NumberValue12 = (unsigned __int128) NumberModulo1 * NumberDigit2 + NumberResidue1;
+                    unsigned __int128 NumberValueLow = (unsigned __int128) (uint64_t) NumberModulo12 * NumberDigit3, NumberValueHigh = (unsigned __int128) (uint64_t) (NumberModulo12 >> 64) * NumberDigit3;
+                    NumberValueHigh += (uint64_t) (NumberValueLow >> 64);
+                    NumberValueLow = (uint64_t) NumberValueLow | NumberValueHigh << 64;
+                    NumberValueHigh >>= 64;
+                    NumberValueLow += NumberValue12;
+                    NumberValueHigh += NumberValueLow < NumberValue12;
+                    unsigned __int128 NumberCurrent = (unsigned __int128) NumberCarry[0] + (uint64_t) NumberValueLow;
+                    NumberCarry[0] = (uint64_t) NumberCurrent;
+                    NumberCurrent = (NumberCurrent >> 64) + NumberCarry[1] + (uint64_t) (NumberValueLow >> 64);
+                    NumberCarry[1] = (uint64_t) NumberCurrent;
+                    NumberCarry[2] += (uint64_t) (NumberCurrent >> 64) + (uint64_t) NumberValueHigh;
+                }
+                NumberTarget[NumberPart] = NumberCarry[0];
+                NumberCarry[0] = NumberCarry[1];
+                NumberCarry[1] = NumberCarry[2];
+                NumberCarry[2] = 0;
+            }
+        }
+
+        template<uint64_t NumberModulo, uint64_t NumberPrimitiveRoot>
+        static void doMultiplicationNTTPrime(uint64_t *NumberTarget, size_t NumberSizeTransform, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            constexpr uint64_t NumberInverse = -getInverseLimb(NumberModulo);
+            constexpr uint64_t NumberMontgomery = (uint64_t) (((unsigned __int128) 1 << 64) % NumberModulo);
+            constexpr uint64_t NumberMontgomerySquare = (uint64_t) ((unsigned __int128) NumberMontgomery * NumberMontgomery % NumberModulo);
+            uint64_t NumberRoot = getPowerModulo(NumberPrimitiveRoot, (NumberModulo - 1) / NumberSizeTransform, NumberModulo);
+            uint64_t NumberRootInverse = getPowerModulo(NumberRoot, NumberModulo - 2, NumberModulo);
+            std::vector<uint64_t> NumberRootList(NumberSizeTransform), NumberTransform;
+            uint64_t *NumberRootForward = NumberRootList.data(), *NumberRootBackward = NumberRootForward + (NumberSizeTransform >> 1);
+            NumberRoot = doReductionMontgomery((unsigned __int128) NumberRoot * NumberMontgomerySquare, NumberModulo, NumberInverse);
+            NumberRootInverse = doReductionMontgomery((unsigned __int128) NumberRootInverse * NumberMontgomerySquare, NumberModulo, NumberInverse);
+            NumberRootForward[0] = NumberRootBackward[0] = NumberMontgomery;
+            for (size_t NumberPart = 1; NumberPart < (NumberSizeTransform >> 1); ++NumberPart) {
+                NumberRootForward[NumberPart] = doReductionMontgomery((unsigned __int128) NumberRootForward[NumberPart - 1] * NumberRoot, NumberModulo, NumberInverse);
+                NumberRootBackward[NumberPart] = doReductionMontgomery((unsigned __int128) NumberRootBackward[NumberPart - 1] * NumberRootInverse, NumberModulo, NumberInverse);
+            }
+            bool NumberSquare = NumberSource1 == NumberSource2 && NumberSize1 == NumberSize2;
+            if (!NumberSquare) NumberTransform.resize(NumberSizeTransform);
+            doParallelTask(NumberSquare ? 0 : NumberSizeTransform, [&] {
+                for (size_t NumberPart = 0; NumberPart < NumberSizeTransform; ++NumberPart)
+                    NumberTarget[NumberPart] = NumberPart < NumberSize1 ? doReductionMontgomery((unsigned __int128) (NumberSource1[NumberPart] % NumberModulo) * NumberMontgomerySquare, NumberModulo, NumberInverse) : 0;
+                doTransformNTT(NumberTarget, NumberSizeTransform, NumberRootForward, 1, NumberModulo, NumberInverse, false);
+            }, [&] {
+                if (NumberSquare) return;
+                for (size_t NumberPart = 0; NumberPart < NumberSizeTransform; ++NumberPart)
+                    NumberTransform[NumberPart] = NumberPart < NumberSize2 ? doReductionMontgomery((unsigned __int128) (NumberSource2[NumberPart] % NumberModulo) * NumberMontgomerySquare, NumberModulo, NumberInverse) : 0;
+                doTransformNTT(NumberTransform.data(), NumberSizeTransform, NumberRootForward, 1, NumberModulo, NumberInverse, false);
+            });
+            for (size_t NumberPart = 0; NumberPart < NumberSizeTransform; ++NumberPart)
+                NumberTarget[NumberPart] = doReductionMontgomery((unsigned __int128) NumberTarget[NumberPart] * (NumberSquare ? NumberTarget[NumberPart] : NumberTransform[NumberPart]), NumberModulo, NumberInverse);
+            doTransformNTT(NumberTarget, NumberSizeTransform, NumberRootBackward, 1, NumberModulo, NumberInverse, true);
+            uint64_t NumberScale = NumberModulo - (NumberModulo - 1) / NumberSizeTransform;
+            for (size_t NumberPart = 0; NumberPart < NumberSizeTransform; ++NumberPart)
+                NumberTarget[NumberPart] = doReductionMontgomery((unsigned __int128) NumberTarget[NumberPart] * NumberScale, NumberModulo, NumberInverse);
+        }
+
+        static void doMultiplicationSchoolbook(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            std::fill(NumberTarget, NumberTarget + NumberSize1 + NumberSize2, 0);
+            for (size_t NumberPart = 0; NumberPart < NumberSize2; ++NumberPart)
+                NumberTarget[NumberPart + NumberSize1] = doMultiplicationAdditionKernel(NumberTarget + NumberPart, NumberSource1, NumberSize1, NumberSource2[NumberPart]);
+        }
+
+        static uint64_t doMultiplicationSubtractionKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, uint64_t NumberMultiplier) noexcept {
+            uint64_t NumberBorrow = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource[NumberPart] * NumberMultiplier + NumberBorrow;
+                uint64_t NumberTargetPart = NumberTarget[NumberPart];
+                NumberTarget[NumberPart] = NumberTargetPart - (uint64_t) NumberCurrent;
+                NumberBorrow = (uint64_t) (NumberCurrent >> 64) + (NumberTargetPart < (uint64_t) NumberCurrent);
+            }
+            return NumberBorrow;
+        }
+
+        static void doMultiplicationToom3(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            size_t NumberSizePart = (NumberSize1 + 2) / 3, NumberSizeProduct = NumberSize1 + NumberSize2;
+            Integer NumberA0(NumberSource1, NumberSizePart), NumberA1(NumberSource1 + NumberSizePart, NumberSizePart), NumberA2(NumberSource1 + (NumberSizePart << 1), NumberSize1 - (NumberSizePart << 1));
+            Integer NumberB0(NumberSource2, NumberSizePart), NumberB1(NumberSource2 + NumberSizePart, NumberSizePart), NumberB2(NumberSource2 + (NumberSizePart << 1), NumberSize2 - (NumberSizePart << 1));
+            Integer NumberA02(NumberA0.doAddition(NumberA2)), NumberB02(NumberB0.doAddition(NumberB2));
+            Integer NumberA1P(NumberA02.doAddition(NumberA1)), NumberB1P(NumberB02.doAddition(NumberB1)), NumberA1M(NumberA02.doSubtraction(NumberA1)), NumberB1M(NumberB02.doSubtraction(NumberB1));
+            Integer NumberAM2(NumberA2.doAddition(NumberA2).doSubtraction(NumberA1)), NumberBM2(NumberB2.doAddition(NumberB2).doSubtraction(NumberB1));
+            NumberAM2 = NumberAM2.doAddition(NumberAM2).doAddition(NumberA0);
+            NumberBM2 = NumberBM2.doAddition(NumberBM2).doAddition(NumberB0);
+            Integer NumberR0, NumberR1, NumberR3, NumberRM1, NumberRInfinity;
+            doParallelTask(NumberSize2, [&] {
+                doMultiplicationCore(NumberR0, NumberA0, NumberB0);
+            }, [&] {
+                doMultiplicationCore(NumberR1, NumberA1P, NumberB1P);
+            }, [&] {
+                doMultiplicationCore(NumberRM1, NumberA1M, NumberB1M);
+            }, [&] {
+                doMultiplicationCore(NumberR3, NumberAM2, NumberBM2);
+            }, [&] {
+                doMultiplicationCore(NumberRInfinity, NumberA2, NumberB2);
+            });
+            NumberR3 = NumberR3.doSubtraction(NumberR1).doDivision(3);
+            Integer NumberR2(NumberRM1.doSubtraction(NumberR0));
+            NumberR1 = NumberR1.doSubtraction(NumberRM1).doShiftRight(1);
+            NumberR3 = NumberR2.doSubtraction(NumberR3).doShiftRight(1).doAddition(NumberRInfinity.doShiftLeft(1));
+            NumberR2 = NumberR2.doAddition(NumberR1).doSubtraction(NumberRInfinity);
+            NumberR1 = NumberR1.doSubtraction(NumberR3);
+            std::fill(NumberTarget, NumberTarget + NumberSizeProduct, 0);
+            const Integer *NumberCoefficientList[] = {&NumberR0, &NumberR1, &NumberR2, &NumberR3, &NumberRInfinity};
+            for (size_t NumberPart = 0; NumberPart < 5; ++NumberPart)
+                if (!NumberCoefficientList[NumberPart]->NumberList.empty() && NumberPart * NumberSizePart < NumberSizeProduct)
+                    doAdditionKernel(NumberTarget + NumberPart * NumberSizePart, NumberTarget + NumberPart * NumberSizePart, NumberSizeProduct - NumberPart * NumberSizePart, NumberCoefficientList[NumberPart]->NumberList.data(), NumberCoefficientList[NumberPart]->NumberList.size());
+        }
+
+        static void doMultiplicationUnbalanced(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            LimbStorage NumberProduct(NumberSize2 << 1, true);
+            doMultiplicationKernel(NumberTarget, NumberSource1, NumberSize2, NumberSource2, NumberSize2);
+            std::fill(NumberTarget + (NumberSize2 << 1), NumberTarget + NumberSize1 + NumberSize2, 0);
+            for (size_t NumberPart = NumberSize2; NumberPart < NumberSize1; NumberPart += NumberSize2) {
+                size_t NumberSizePart = std::min(NumberSize2, NumberSize1 - NumberPart);
+                doMultiplicationKernel(NumberProduct.data(), NumberSource1 + NumberPart, NumberSizePart, NumberSource2, NumberSize2);
+                doAdditionKernel(NumberTarget + NumberPart, NumberTarget + NumberPart, NumberSize1 + NumberSize2 - NumberPart, NumberProduct.data(), NumberSizePart + NumberSize2);
+            }
+        }
+
+        template<typename ...F>
+        static void doParallelTask(size_t NumberSize, F &&...doTask) noexcept {
+            if (NumberSize < NumberParallelThreshold.load(std::memory_order_relaxed) || NumberParallelAvailable.load(std::memory_order_relaxed) <= 0) {
+                (doTask(), ...);
+                return;
+            }
+            std::thread NumberThreadList[sizeof...(F)];
+            size_t NumberTaskCount = 0, NumberThreadCount = 0;
+            auto doDispatch = [&](auto &doTaskCurrent) {
+                if (++NumberTaskCount < sizeof...(F)) {
+                    if (NumberParallelAvailable.fetch_sub(1, std::memory_order_acquire) > 0)
+                        try {
+                            NumberThreadList[NumberThreadCount] = std::thread(std::ref(doTaskCurrent));
+                            ++NumberThreadCount;
+                            return;
+                        } catch (const std::system_error&) {}
+                    NumberParallelAvailable.fetch_add(1, std::memory_order_release);
+                }
+                doTaskCurrent();
+            };
+            (doDispatch(doTask), ...);
+            for (size_t NumberThread = 0; NumberThread < NumberThreadCount; ++NumberThread) {
+                NumberThreadList[NumberThread].join();
+                NumberParallelAvailable.fetch_add(1, std::memory_order_release);
+            }
+        }
+
+        static uint64_t doReductionMontgomery(unsigned __int128 NumberSource, uint64_t NumberModulo, uint64_t NumberInverse) noexcept {
+            uint64_t NumberResult = (uint64_t) ((NumberSource + (unsigned __int128) ((uint64_t) NumberSource * NumberInverse) * NumberModulo) >> 64);
+            return NumberResult >= NumberModulo ? NumberResult - NumberModulo : NumberResult;
+        }
+
+        static void doReductionMontgomeryKernel(uint64_t *NumberTarget, uint64_t *NumberSource, const uint64_t *NumberModulo, size_t NumberSize, uint64_t NumberInverse) noexcept {
+            uint64_t NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource[NumberPart + NumberSize] + NumberCarry + doMultiplicationAdditionKernel(NumberSource + NumberPart, NumberModulo, NumberSize, NumberSource[NumberPart] * NumberInverse);
+                NumberSource[NumberPart + NumberSize] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+            if (NumberCarry || doCompareKernel(NumberSource + NumberSize, NumberSize, NumberModulo, NumberSize) >= 0)
+                doSubtractionKernel(NumberTarget, NumberSource + NumberSize, NumberSize, NumberModulo, NumberSize);
+            else std::copy(NumberSource + NumberSize, NumberSource + (NumberSize << 1), NumberTarget);
+        }
+
+        static void doTransformNTT(uint64_t *NumberTarget, size_t NumberSizeTransform, const uint64_t *NumberRootList, size_t NumberRootStride, uint64_t NumberModulo, uint64_t NumberInverse, bool NumberBackward) noexcept {
+            if (NumberSizeTransform >= NumberParallelThreshold.load(std::memory_order_relaxed) << 2 && NumberParallelAvailable.load(std::memory_order_relaxed) > 0) {
+                size_t NumberSizeHalf = NumberSizeTransform >> 1;
+                if (!NumberBackward) doTransformNTTStage(NumberTarget, NumberSizeTransform, 0, NumberSizeHalf, NumberRootList, NumberRootStride, NumberModulo, NumberInverse, false);
+                doParallelTask(NumberSizeTransform, [&] {
+                    doTransformNTT(NumberTarget, NumberSizeHalf, NumberRootList, NumberRootStride << 1, NumberModulo, NumberInverse, NumberBackward);
+                }, [&] {
+                    doTransformNTT(NumberTarget + NumberSizeHalf, NumberSizeHalf, NumberRootList, NumberRootStride << 1, NumberModulo, NumberInverse, NumberBackward);
+                });
+                if (NumberBackward) doTransformNTTStage(NumberTarget, NumberSizeTransform, 0, NumberSizeHalf, NumberRootList, NumberRootStride, NumberModulo, NumberInverse, true);
+                return;
+            }
+            for (size_t NumberStep = NumberBackward ? 1 : NumberSizeTransform >> 1; NumberStep && NumberStep < NumberSizeTransform; NumberStep = NumberBackward ? NumberStep << 1 : NumberStep >> 1) {
+                size_t NumberStride = NumberRootStride * ((NumberSizeTransform >> 1) / NumberStep);
+                for (size_t NumberBlock = 0; NumberBlock < NumberSizeTransform; NumberBlock += NumberStep << 1)
+                    for (size_t NumberPart = 0; NumberPart < NumberStep; ++NumberPart) {
+                        uint64_t &NumberEven = NumberTarget[NumberBlock + NumberPart], &NumberOdd = NumberTarget[NumberBlock + NumberPart + NumberStep];
+                        if (NumberBackward) NumberOdd = doReductionMontgomery((unsigned __int128) NumberOdd * NumberRootList[NumberPart * NumberStride], NumberModulo, NumberInverse);
+                        uint64_t NumberSummation = NumberEven + NumberOdd, NumberDifference = NumberEven + NumberModulo - NumberOdd;
+                        NumberEven = NumberSummation >= NumberModulo ? NumberSummation - NumberModulo : NumberSummation;
+                        NumberOdd = NumberDifference >= NumberModulo ? NumberDifference - NumberModulo : NumberDifference;
+                        if (!NumberBackward) NumberOdd = doReductionMontgomery((unsigned __int128) NumberOdd * NumberRootList[NumberPart * NumberStride], NumberModulo, NumberInverse);
+                    }
+            }
+        }
+
+        static void doTransformNTTStage(uint64_t *NumberTarget, size_t NumberSizeBlock, size_t NumberBegin, size_t NumberEnd, const uint64_t *NumberRootList, size_t NumberRootStride, uint64_t NumberModulo, uint64_t NumberInverse, bool NumberBackward) noexcept {
+            if (NumberEnd - NumberBegin >= NumberParallelThreshold.load(std::memory_order_relaxed) << 1 && NumberParallelAvailable.load(std::memory_order_relaxed) > 0) {
+                size_t NumberMiddle = NumberBegin + ((NumberEnd - NumberBegin) >> 1);
+                doParallelTask(NumberEnd - NumberBegin, [&] {
+                    doTransformNTTStage(NumberTarget, NumberSizeBlock, NumberBegin, NumberMiddle, NumberRootList, NumberRootStride, NumberModulo, NumberInverse, NumberBackward);
+                }, [&] {
+                    doTransformNTTStage(NumberTarget, NumberSizeBlock, NumberMiddle, NumberEnd, NumberRootList, NumberRootStride, NumberModulo, NumberInverse, NumberBackward);
+                });
+                return;
+            }
+            size_t NumberStep = NumberSizeBlock >> 1;
+            for (size_t NumberPart = NumberBegin; NumberPart < NumberEnd; ++NumberPart) {
+                uint64_t &NumberEven = NumberTarget[NumberPart], &NumberOdd = NumberTarget[NumberPart + NumberStep];
+                if (NumberBackward) NumberOdd = doReductionMontgomery((unsigned __int128) NumberOdd * NumberRootList[NumberPart * NumberRootStride], NumberModulo, NumberInverse);
+                uint64_t NumberSummation = NumberEven + NumberOdd, NumberDifference = NumberEven + NumberModulo - NumberOdd;
+                NumberEven = NumberSummation >= NumberModulo ? NumberSummation - NumberModulo : NumberSummation;
+                NumberOdd = NumberDifference >= NumberModulo ? NumberDifference - NumberModulo : NumberDifference;
+                if (!NumberBackward) NumberOdd = doReductionMontgomery((unsigned __int128) NumberOdd * NumberRootList[NumberPart * NumberRootStride], NumberModulo, NumberInverse);
+            }
+        }
+
+        static uint64_t doShiftLeftKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, unsigned short NumberShift) noexcept {
+            if (!NumberShift) {
+                std::copy_backward(NumberSource, NumberSource + NumberSize, NumberTarget + NumberSize);
+                return 0;
+            }
+            if (!NumberSize) return 0;
+            uint64_t NumberCarry = NumberSource[NumberSize - 1] >> (64 - NumberShift);
+            for (size_t NumberPart = NumberSize - 1; NumberPart > 0; --NumberPart)
+                NumberTarget[NumberPart] = NumberSource[NumberPart] << NumberShift | NumberSource[NumberPart - 1] >> (64 - NumberShift);
+            NumberTarget[0] = NumberSource[0] << NumberShift;
+            return NumberCarry;
+        }
+
+        static void doShiftRightKernel(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize, unsigned short NumberShift) noexcept {
+            if (!NumberShift) {
+                std::copy(NumberSource, NumberSource + NumberSize, NumberTarget);
+                return;
+            }
+            for (size_t NumberPart = 0; NumberPart + 1 < NumberSize; ++NumberPart)
+                NumberTarget[NumberPart] = NumberSource[NumberPart] >> NumberShift | NumberSource[NumberPart + 1] << (64 - NumberShift);
+            if (NumberSize) NumberTarget[NumberSize - 1] = NumberSource[NumberSize - 1] >> NumberShift;
+        }
+
+        static void doSquareSchoolbook(uint64_t *NumberTarget, const uint64_t *NumberSource, size_t NumberSize) noexcept {
+            std::fill(NumberTarget, NumberTarget + (NumberSize << 1), 0);
+            for (size_t NumberPart = 0; NumberPart + 1 < NumberSize; ++NumberPart)
+                NumberTarget[NumberPart + NumberSize] = doMultiplicationAdditionKernel(NumberTarget + (NumberPart << 1) + 1, NumberSource + NumberPart + 1, NumberSize - NumberPart - 1, NumberSource[NumberPart]);
+            doShiftLeftKernel(NumberTarget, NumberTarget, NumberSize << 1, 1);
+            uint64_t NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberSquare = (unsigned __int128) NumberSource[NumberPart] * NumberSource[NumberPart];
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberTarget[NumberPart << 1] + (uint64_t) NumberSquare + NumberCarry;
+                NumberTarget[NumberPart << 1] = (uint64_t) NumberCurrent;
+                NumberCurrent = (unsigned __int128) NumberTarget[(NumberPart << 1) + 1] + (uint64_t) (NumberSquare >> 64) + (uint64_t) (NumberCurrent >> 64);
+                NumberTarget[(NumberPart << 1) + 1] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+        }
+
+        static uint64_t doSubtractionKernel(uint64_t *NumberTarget, const uint64_t *NumberSource1, size_t NumberSize1, const uint64_t *NumberSource2, size_t NumberSize2) noexcept {
+            uint64_t NumberBorrow = 0;
+            size_t NumberPart = 0;
+#if defined(__x86_64__)
+            if (NumberSize2 >= NumberVectorThreshold && NumberInstructionSet) {
+                NumberPart = NumberSize2 & ~(size_t) 7;
+                NumberBorrow = NumberInstructionSet & NumberInstructionAVX512 ? doSubtractionKernelAVX512(NumberTarget, NumberSource1, NumberSource2, NumberPart) : doSubtractionKernelAVX2(NumberTarget, NumberSource1, NumberSource2, NumberPart);
+            }
+#endif
+            for (; NumberPart < NumberSize2; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource1[NumberPart] - NumberSource2[NumberPart] - NumberBorrow;
+                NumberTarget[NumberPart] = (uint64_t) NumberCurrent;
+                NumberBorrow = (uint64_t) (NumberCurrent >> 64) & 1;
+            }
+            for (; NumberPart < NumberSize1; ++NumberPart) {
+                uint64_t NumberCurrent = NumberSource1[NumberPart];
+                NumberTarget[NumberPart] = NumberCurrent - NumberBorrow;
+                NumberBorrow = NumberCurrent < NumberBorrow;
+            }
+            return NumberBorrow;
+        }
+
+#if defined(__x86_64__)
+        __attribute__((target("avx2")))
+        static uint64_t doSubtractionKernelAVX2(uint64_t *NumberTarget, const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            const __m256i NumberBias = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min()), NumberLane = _mm256_setr_epi64x(1, 2, 4, 8);
+            unsigned NumberBorrow = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; NumberPart += 4) {
+                __m256i Number1 = _mm256_loadu_si256((const __m256i*) (NumberSource1 + NumberPart)), Number2 = _mm256_loadu_si256((const __m256i*) (NumberSource2 + NumberPart)), NumberDifference = _mm256_sub_epi64(Number1, Number2);
+                auto NumberGenerate = (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_xor_si256(Number2, NumberBias), _mm256_xor_si256(Number1, NumberBias))));
+                auto NumberPropagate = (unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(NumberDifference, _mm256_setzero_si256())));
+                unsigned NumberLookahead = (NumberGenerate << 1 | NumberBorrow) + NumberPropagate;
+                NumberBorrow = NumberLookahead >> 4;
+                __m256i NumberMask = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x((NumberLookahead ^ NumberPropagate) & 15), NumberLane), NumberLane);
+                _mm256_storeu_si256((__m256i*) (NumberTarget + NumberPart), _mm256_add_epi64(NumberDifference, NumberMask));
+            }
+            return NumberBorrow;
+        }
+
+        __attribute__((target("avx512f")))
+        static uint64_t doSubtractionKernelAVX512(uint64_t *NumberTarget, const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSize) noexcept {
+            const __m512i NumberMaximum = _mm512_set1_epi64(-1);
+            unsigned NumberBorrow = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; NumberPart += 8) {
+                __m512i Number1 = _mm512_loadu_si512(NumberSource1 + NumberPart), Number2 = _mm512_loadu_si512(NumberSource2 + NumberPart), NumberDifference = _mm512_sub_epi64(Number1, Number2);
+                unsigned NumberPropagate = _mm512_cmpeq_epi64_mask(NumberDifference, _mm512_setzero_si512()), NumberLookahead = ((unsigned) _mm512_cmplt_epu64_mask(Number1, Number2) << 1 | NumberBorrow) + NumberPropagate;
+                NumberBorrow = NumberLookahead >> 8;
+                _mm512_storeu_si512(NumberTarget + NumberPart, _mm512_mask_add_epi64(NumberDifference, (__mmask8) (NumberLookahead ^ NumberPropagate), NumberDifference, NumberMaximum));
+            }
+            return NumberBorrow;
+        }
+#endif
+
+        static void doAdditionCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2, bool NumberSignature2) noexcept {
+            bool NumberSignature1 = Number1.NumberSignature;
+            size_t NumberSize1 = Number1.NumberList.size(), NumberSize2 = Number2.NumberList.size();
+            if (NumberSize1 <= 2 && NumberSize2 <= 2) {
+                unsigned __int128 NumberValue1 = Number1.getValueNative(), NumberValue2 = Number2.getValueNative();
+                if (NumberSignature1 == NumberSignature2) {
+                    NumberResult.setValueNative(NumberValue1 + NumberValue2, NumberValue1 + NumberValue2 < NumberValue1);
+                    NumberResult.NumberSignature = NumberSignature1;
+                } else if (NumberValue1 >= NumberValue2) {
+                    NumberResult.setValueNative(NumberValue1 - NumberValue2);
+                    NumberResult.NumberSignature = NumberSignature1;
+                } else {
+                    NumberResult.setValueNative(NumberValue2 - NumberValue1);
+                    NumberResult.NumberSignature = NumberSignature2;
+                }
+                NumberResult.doNormalize();
+                return;
+            }
+            if (NumberSignature1 == NumberSignature2) {
+                if (NumberSize1 < NumberSize2) {
+                    NumberResult.NumberList.resize(NumberSize2 + 1);
+                    NumberResult.NumberList[NumberSize2] = doAdditionKernel(NumberResult.NumberList.data(), Number2.NumberList.data(), NumberSize2, Number1.NumberList.data(), NumberSize1);
+                } else {
+                    NumberResult.NumberList.resize(NumberSize1 + 1);
+                    NumberResult.NumberList[NumberSize1] = doAdditionKernel(NumberResult.NumberList.data(), Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+                }
+                NumberResult.NumberSignature = NumberSignature1;
+            } else {
+                intmax_t NumberRelation = doCompareKernel(Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+                if (NumberRelation >= 0) {
+                    NumberResult.NumberList.resize(NumberSize1);
+                    doSubtractionKernel(NumberResult.NumberList.data(), Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+                    NumberResult.NumberSignature = NumberSignature1;
+                } else {
+                    NumberResult.NumberList.resize(NumberSize2);
+                    doSubtractionKernel(NumberResult.NumberList.data(), Number2.NumberList.data(), NumberSize2, Number1.NumberList.data(), NumberSize1);
+                    NumberResult.NumberSignature = NumberSignature2;
+                }
+            }
+            NumberResult.doNormalize();
+        }
+
+        template<typename F>
+        static void doBitwiseCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2, F doBitwiseStep) noexcept {
+            size_t NumberSize1 = Number1.NumberList.size(), NumberSize2 = Number2.NumberList.size(), NumberSize = std::max(NumberSize1, NumberSize2);
+            bool NumberNegative1 = !Number1.NumberSignature, NumberNegative2 = !Number2.NumberSignature, NumberNegative = doBitwiseStep(NumberNegative1 ? ~(uint64_t) 0 : 0, NumberNegative2 ? ~(uint64_t) 0 : 0);
+            NumberResult.NumberList.resize(std::max(NumberSize, NumberResult.NumberList.size()));
+            const uint64_t *NumberSource1 = Number1.NumberList.data(), *NumberSource2 = Number2.NumberList.data();
+            uint64_t *NumberTarget = NumberResult.NumberList.data(), NumberBorrow1 = NumberNegative1, NumberBorrow2 = NumberNegative2, NumberCarry = NumberNegative;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                uint64_t NumberLimb1 = NumberPart < NumberSize1 ? NumberSource1[NumberPart] : 0, NumberLimb2 = NumberPart < NumberSize2 ? NumberSource2[NumberPart] : 0;
+                if (NumberNegative1) {
+                    uint64_t NumberCurrent = NumberLimb1 - NumberBorrow1;
+                    NumberBorrow1 = NumberLimb1 < NumberBorrow1;
+                    NumberLimb1 = ~NumberCurrent;
+                }
+                if (NumberNegative2) {
+                    uint64_t NumberCurrent = NumberLimb2 - NumberBorrow2;
+                    NumberBorrow2 = NumberLimb2 < NumberBorrow2;
+                    NumberLimb2 = ~NumberCurrent;
+                }
+                uint64_t NumberLimb = doBitwiseStep(NumberLimb1, NumberLimb2);
+                if (NumberNegative) {
+                    NumberLimb = ~NumberLimb + NumberCarry;
+                    NumberCarry = NumberCarry && !NumberLimb;
+                }
+                NumberTarget[NumberPart] = NumberLimb;
+            }
+            NumberResult.NumberList.resize(NumberSize);
+            if (NumberCarry) NumberResult.NumberList.push_back(1);
+            NumberResult.NumberSignature = !NumberNegative;
+            NumberResult.doNormalize();
+        }
+
+        static void doDivisionBasecase(const Integer &NumberDividend, const Integer &NumberDivisor, Integer *NumberQuotient, Integer *NumberRemainder) noexcept {
+            size_t NumberSizeDividend = NumberDividend.NumberList.size(), NumberSizeDivisor = NumberDivisor.NumberList.size();
+            if (doCompareKernel(NumberDividend.NumberList.data(), NumberSizeDividend, NumberDivisor.NumberList.data(), NumberSizeDivisor) < 0) {
+                if (NumberRemainder) {
+                    NumberRemainder->NumberList = NumberDividend.NumberList;
+                    NumberRemainder->NumberSignature = true;
+                }
+                if (NumberQuotient) {
+                    NumberQuotient->NumberList.clear();
+                    NumberQuotient->NumberSignature = true;
+                }
+                return;
+            }
+            thread_local std::vector<uint64_t> NumberDivisorList, NumberQuotientList, NumberRemainderList;
+            NumberQuotientList.resize(NumberSizeDividend - NumberSizeDivisor + 1);
+            if (NumberSizeDivisor == 1) {
+                uint64_t NumberRemainderLimb = doDivisionLimbKernel(NumberQuotientList.data(), NumberDividend.NumberList.data(), NumberSizeDividend, NumberDivisor.NumberList[0]);
+                NumberRemainderList.assign(NumberRemainderLimb != 0, NumberRemainderLimb);
+            } else {
+                auto NumberShift = (unsigned short) std::countl_zero(NumberDivisor.NumberList.back());
+                NumberDivisorList.resize(NumberSizeDivisor);
+                NumberRemainderList.resize(NumberSizeDividend + 1);
+                doShiftLeftKernel(NumberDivisorList.data(), NumberDivisor.NumberList.data(), NumberSizeDivisor, NumberShift);
+                NumberRemainderList[NumberSizeDividend] = doShiftLeftKernel(NumberRemainderList.data(), NumberDividend.NumberList.data(), NumberSizeDividend, NumberShift);
+                doDivisionKnuthKernel(NumberQuotientList.data(), NumberRemainderList.data(), NumberSizeDividend, NumberDivisorList.data(), NumberSizeDivisor);
+                doShiftRightKernel(NumberRemainderList.data(), NumberRemainderList.data(), NumberSizeDivisor, NumberShift);
+                NumberRemainderList.resize(NumberSizeDivisor);
+            }
+            if (NumberQuotient) {
+                NumberQuotient->NumberList.assign(NumberQuotientList.data(), NumberQuotientList.data() + NumberQuotientList.size());
+                NumberQuotient->NumberSignature = true;
+                NumberQuotient->doNormalize();
+            }
+            if (NumberRemainder) {
+                NumberRemainder->NumberList.assign(NumberRemainderList.data(), NumberRemainderList.data() + NumberRemainderList.size());
+                NumberRemainder->NumberSignature = true;
+                NumberRemainder->doNormalize();
+            }
+        }
+
+        static void doDivisionBurnikelZiegler(const Integer &NumberDividend, const Integer &NumberDivisor, Integer &NumberQuotient, Integer &NumberRemainder) noexcept {
+            auto NumberShift = (unsigned short) std::countl_zero(NumberDivisor.NumberList.back());
+            Integer NumberDividendNormalized(NumberDividend), NumberDivisorNormalized(NumberDivisor);
+            NumberDividendNormalized.doShiftLeftAssign(NumberShift);
+            NumberDivisorNormalized.doShiftLeftAssign(NumberShift);
+            size_t NumberSizeDivisor = NumberDivisorNormalized.NumberList.size(), NumberSizeDividend = NumberDividendNormalized.NumberList.size();
+            size_t NumberBlockCount = (NumberSizeDividend + NumberSizeDivisor - 1) / NumberSizeDivisor;
+            LimbStorage NumberQuotientList(NumberBlockCount * NumberSizeDivisor);
+            for (size_t NumberBlock = NumberBlockCount; NumberBlock-- > 0;) {
+                size_t NumberOffset = NumberBlock * NumberSizeDivisor;
+                Integer NumberBlockQuotient, NumberBlockDividend(NumberRemainder.doShiftLimb((intmax_t) NumberSizeDivisor).doAddition(Integer(NumberDividendNormalized.NumberList.data() + NumberOffset, std::min(NumberSizeDivisor, NumberSizeDividend - NumberOffset))));
+                doDivisionBurnikelZiegler21(NumberBlockDividend, NumberDivisorNormalized, NumberSizeDivisor, NumberBlockQuotient, NumberRemainder);
+                std::copy(NumberBlockQuotient.NumberList.begin(), NumberBlockQuotient.NumberList.end(), NumberQuotientList.begin() + NumberOffset);
+            }
+            NumberQuotient.NumberList = std::move(NumberQuotientList);
+            NumberQuotient.doNormalize();
+            NumberRemainder.doShiftRightAssign(NumberShift);
+        }
+
+        static void doDivisionBurnikelZiegler21(const Integer &NumberDividend, const Integer &NumberDivisor, size_t NumberSize, Integer &NumberQuotient, Integer &NumberRemainder) noexcept {
+            if (NumberSize < NumberBurnikelZieglerThreshold) {
+                doDivisionBasecase(NumberDividend, NumberDivisor, &NumberQuotient, &NumberRemainder);
+                return;
+            }
+            if (NumberSize & 1) {
+                doDivisionBurnikelZiegler21(NumberDividend.doShiftLimb(1), NumberDivisor.doShiftLimb(1), NumberSize + 1, NumberQuotient, NumberRemainder);
+                NumberRemainder = NumberRemainder.doShiftLimb(-1);
+                return;
+            }
+            size_t NumberSizeHalf = NumberSize >> 1;
+            Integer NumberDivisorHigh(NumberDivisor.doShiftLimb(-(intmax_t) NumberSizeHalf)), NumberDivisorLow(NumberDivisor.getLimbLow(NumberSizeHalf)), NumberDividendLow(NumberDividend.getLimbLow(NumberSizeHalf)), NumberQuotientHigh;
+            doDivisionBurnikelZiegler32(NumberDividend.doShiftLimb(-(intmax_t) NumberSize), NumberDividend.doShiftLimb(-(intmax_t) NumberSizeHalf).getLimbLow(NumberSizeHalf), NumberDivisor, NumberDivisorHigh, NumberDivisorLow, NumberSizeHalf, NumberQuotientHigh, NumberRemainder);
+            doDivisionBurnikelZiegler32(NumberRemainder, NumberDividendLow, NumberDivisor, NumberDivisorHigh, NumberDivisorLow, NumberSizeHalf, NumberQuotient, NumberRemainder);
+            NumberQuotient = NumberQuotientHigh.doShiftLimb((intmax_t) NumberSizeHalf).doAdditionAssign(NumberQuotient);
+        }
+
+        static void doDivisionBurnikelZiegler32(const Integer &NumberDividendHigh, const Integer &NumberDividendLow, const Integer &NumberDivisor, const Integer &NumberDivisorHigh, const Integer &NumberDivisorLow, size_t NumberSize, Integer &NumberQuotient, Integer &NumberRemainder) noexcept {
+            if (!NumberDividendHigh.doShiftLimb(-(intmax_t) NumberSize).doCompare(NumberDivisorHigh)) {
+                NumberQuotient.NumberList.assign(NumberSize, std::numeric_limits<uint64_t>::max());
+                NumberQuotient.NumberSignature = true;
+                NumberRemainder = NumberDividendHigh.doSubtraction(NumberDivisorHigh.doShiftLimb((intmax_t) NumberSize)).doAdditionAssign(NumberDivisorHigh);
+            } else doDivisionBurnikelZiegler21(NumberDividendHigh, NumberDivisorHigh, NumberSize, NumberQuotient, NumberRemainder);
+            NumberRemainder = NumberRemainder.doShiftLimb((intmax_t) NumberSize).doAdditionAssign(NumberDividendLow).doSubtractionAssign(NumberQuotient.doMultiplication(NumberDivisorLow));
+            while (NumberRemainder.isNegative()) {
+                NumberQuotient.doSubtractionAssign(1);
+                NumberRemainder.doAdditionAssign(NumberDivisor);
+            }
+        }
+
+        static void doDivisionCore(const Integer &NumberDividend, const Integer &NumberDivisor, Integer *NumberQuotient, Integer *NumberRemainder) {
+            if (NumberDivisor.NumberList.empty()) throw Exception(String(u"Integer::doDivisionCore(const Integer&, const Integer&, Integer*, Integer*) NumberDivisor"));
+            if (NumberDividend.NumberList.size() <= 2 && NumberDivisor.NumberList.size() <= 2) {
+                unsigned __int128 NumberValueDividend = NumberDividend.getValueNative(), NumberValueDivisor = NumberDivisor.getValueNative(), NumberValueQuotient, NumberValueRemainder;
+                if ((NumberValueDividend | NumberValueDivisor) >> 64) {
+                    NumberValueQuotient = NumberValueDividend / NumberValueDivisor;
+                    NumberValueRemainder = NumberValueDividend % NumberValueDivisor;
+                } else {
+                    NumberValueQuotient = (uint64_t) NumberValueDividend / (uint64_t) NumberValueDivisor;
+                    NumberValueRemainder = (uint64_t) NumberValueDividend % (uint64_t) NumberValueDivisor;
+                }
+                if (NumberQuotient) {
+                    NumberQuotient->setValueNative(NumberValueQuotient);
+                    NumberQuotient->NumberSignature = true;
+                    NumberQuotient->doNormalize();
+                }
+                if (NumberRemainder) {
+                    NumberRemainder->setValueNative(NumberValueRemainder);
+                    NumberRemainder->NumberSignature = true;
+                    NumberRemainder->doNormalize();
+                }
+                return;
+            }
+            if (NumberDivisor.NumberList.size() >= NumberBurnikelZieglerThreshold && NumberDividend.NumberList.size() >= NumberDivisor.NumberList.size() + NumberBurnikelZieglerThreshold) {
+                Integer NumberQuotientResult, NumberRemainderResult;
+                doDivisionBurnikelZiegler(NumberDividend.getAbsolute(), NumberDivisor.getAbsolute(), NumberQuotientResult, NumberRemainderResult);
+                if (NumberQuotient) *NumberQuotient = std::move(NumberQuotientResult);
+                if (NumberRemainder) *NumberRemainder = std::move(NumberRemainderResult);
+            } else doDivisionBasecase(NumberDividend, NumberDivisor, NumberQuotient, NumberRemainder);
+        }
+
+        static Integer doGreatestCommonFactorCore(Integer NumberA, Integer NumberB, Integer *NumberCoefficient) noexcept {
+            NumberA.NumberSignature = NumberB.NumberSignature = true;
+            Integer NumberCoefficientA(1), NumberCoefficientB, NumberQuotient, NumberRemainder, NumberTemporary1, NumberTemporary2;
+            if (doCompareKernel(NumberA.NumberList.data(), NumberA.NumberList.size(), NumberB.NumberList.data(), NumberB.NumberList.size()) < 0) {
+                NumberA.NumberList.swap(NumberB.NumberList);
+                std::swap(NumberCoefficientA, NumberCoefficientB);
+            }
+            auto doCombination = [&](Integer &NumberTarget, const Integer &Number1, int64_t NumberFactor1, const Integer &Number2, int64_t NumberFactor2) {
+                doMultiplicationCore(NumberTemporary1, Number1, NumberFactor1);
+                doMultiplicationCore(NumberTemporary2, Number2, NumberFactor2);
+                doAdditionCore(NumberTarget, NumberTemporary1, NumberTemporary2, NumberTemporary2.NumberSignature);
+            };
+            while (NumberB.NumberList.size() > (NumberCoefficient ? 0 : 2)) {
+                if (NumberA.NumberList.size() <= NumberB.NumberList.size() + 1) {
+                    size_t NumberShift = std::max(NumberA.getBitLength(), (size_t) 63) - 63;
+                    __int128 NumberX = NumberA.getBitWindow(NumberShift), NumberY = NumberB.getBitWindow(NumberShift) & std::numeric_limits<int64_t>::max();
+                    int64_t NumberFactorA = 1, NumberFactorB = 0, NumberFactorC = 0, NumberFactorD = 1;
+                    while (NumberY + NumberFactorC > 0 && NumberY + NumberFactorD > 0) {
+                        __int128 NumberEstimate = (NumberX + NumberFactorA) / (NumberY + NumberFactorC);
+                        if (NumberEstimate != (NumberX + NumberFactorB) / (NumberY + NumberFactorD)) break;
+                        std::tie(NumberFactorA, NumberFactorC) = std::make_pair(NumberFactorC, (int64_t) (NumberFactorA - (__int128) NumberEstimate * NumberFactorC));
+                        std::tie(NumberFactorB, NumberFactorD) = std::make_pair(NumberFactorD, (int64_t) (NumberFactorB - (__int128) NumberEstimate * NumberFactorD));
+                        std::tie(NumberX, NumberY) = std::make_pair(NumberY, NumberX - NumberEstimate * NumberY);
+                    }
+                    if (NumberFactorB) {
+                        doCombination(NumberRemainder, NumberA, NumberFactorC, NumberB, NumberFactorD);
+                        doCombination(NumberA, NumberA, NumberFactorA, NumberB, NumberFactorB);
+                        NumberB.NumberList.swap(NumberRemainder.NumberList);
+                        if (NumberCoefficient) {
+                            doCombination(NumberRemainder, NumberCoefficientA, NumberFactorC, NumberCoefficientB, NumberFactorD);
+                            doCombination(NumberCoefficientA, NumberCoefficientA, NumberFactorA, NumberCoefficientB, NumberFactorB);
+                            std::swap(NumberCoefficientB, NumberRemainder);
+                        }
+                        continue;
+                    }
+                }
+                doDivisionCore(NumberA, NumberB, &NumberQuotient, &NumberRemainder);
+                NumberA.NumberList.swap(NumberB.NumberList);
+                NumberB.NumberList.swap(NumberRemainder.NumberList);
+                if (NumberCoefficient) {
+                    NumberQuotient.NumberSignature = true;
+                    doMultiplicationCore(NumberQuotient, NumberQuotient, NumberCoefficientB);
+                    doAdditionCore(NumberCoefficientA, NumberCoefficientA, NumberQuotient, !NumberQuotient.NumberSignature);
+                    std::swap(NumberCoefficientA, NumberCoefficientB);
+                }
+            }
+            if (NumberCoefficient) {
+                *NumberCoefficient = std::move(NumberCoefficientA);
+                return NumberA;
+            }
+            if (NumberB.NumberList.empty()) return NumberA;
+            if (NumberA.NumberList.size() > 2) {
+                doDivisionCore(NumberA, NumberB, nullptr, &NumberRemainder);
+                NumberA.NumberList.swap(NumberB.NumberList);
+                NumberB.NumberList.swap(NumberRemainder.NumberList);
+                if (NumberB.NumberList.empty()) return NumberA;
+            }
+            if (NumberA.NumberList.size() == 1) {
+                uint64_t NumberValueA = NumberA.NumberList[0], NumberValueB = NumberB.NumberList[0];
+                int NumberShift = std::countr_zero(NumberValueA | NumberValueB);
+                NumberValueA >>= std::countr_zero(NumberValueA);
+                do {
+                    NumberValueB >>= std::countr_zero(NumberValueB);
+                    if (NumberValueA > NumberValueB) std::swap(NumberValueA, NumberValueB);
+                    NumberValueB -= NumberValueA;
+                } while (NumberValueB);
+                NumberA.NumberList[0] = NumberValueA << NumberShift;
+                return NumberA;
+            }
+            unsigned __int128 NumberValueA = NumberA.getValueNative(), NumberValueB = NumberB.getValueNative();
+            auto getTrailingZeroNative = [](unsigned __int128 NumberValue) {
+                return (uint64_t) NumberValue ? std::countr_zero((uint64_t) NumberValue) : 64 + std::countr_zero((uint64_t) (NumberValue >> 64));
+            };
+            int NumberShift = getTrailingZeroNative(NumberValueA | NumberValueB);
+            NumberValueA >>= getTrailingZeroNative(NumberValueA);
+            do {
+                NumberValueB >>= getTrailingZeroNative(NumberValueB);
+                if (NumberValueA > NumberValueB) std::swap(NumberValueA, NumberValueB);
+                NumberValueB -= NumberValueA;
+            } while (NumberValueB);
+            NumberA.setValueNative(NumberValueA << NumberShift);
+            NumberA.doNormalize();
+            return NumberA;
+        }
+
+        static void doMultiplicationAdditionCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2, const Integer &Number3, bool NumberSignature3) noexcept {
+            size_t NumberSize1 = Number1.NumberList.size(), NumberSize2 = Number2.NumberList.size();
+            if (NumberSize1 && NumberSize2 && NumberSize1 + NumberSize2 > 2 && std::min(NumberSize1, NumberSize2) < NumberKaratsubaThreshold && (Number1.NumberSignature == Number2.NumberSignature) == NumberSignature3 && &Number1 != &Number2 && &NumberResult != &Number1 && &NumberResult != &Number2) {
+                const uint64_t *NumberSource1 = Number1.NumberList.data(), *NumberSource2 = Number2.NumberList.data();
+                if (NumberSize1 < NumberSize2) {
+                    std::swap(NumberSource1, NumberSource2);
+                    std::swap(NumberSize1, NumberSize2);
+                }
+                if (&NumberResult != &Number3) NumberResult.NumberList.assign(Number3.NumberList.begin(), Number3.NumberList.end());
+                NumberResult.NumberList.resize(std::max(NumberSize1 + NumberSize2, Number3.NumberList.size()) + 1);
+                uint64_t *NumberTarget = NumberResult.NumberList.data();
+                for (size_t NumberPart = 0; NumberPart < NumberSize2; ++NumberPart) {
+                    uint64_t NumberCarry = doMultiplicationAdditionKernel(NumberTarget + NumberPart, NumberSource1, NumberSize1, NumberSource2[NumberPart]);
+                    for (size_t NumberPosition = NumberPart + NumberSize1; NumberCarry; ++NumberPosition)
+                        NumberCarry = (NumberTarget[NumberPosition] += NumberCarry) < NumberCarry;
+                }
+                NumberResult.NumberSignature = NumberSignature3;
+                NumberResult.doNormalize();
+                return;
+            }
+            if (&NumberResult == &Number3) {
+                Integer NumberProduct;
+                doMultiplicationCore(NumberProduct, Number1, Number2);
+                doAdditionCore(NumberResult, NumberProduct, Number3, NumberSignature3);
+            } else {
+                doMultiplicationCore(NumberResult, Number1, Number2);
+                doAdditionCore(NumberResult, NumberResult, Number3, NumberSignature3);
+            }
+        }
+
+        static void doMultiplicationCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2) noexcept {
+            size_t NumberSize1 = Number1.NumberList.size(), NumberSize2 = Number2.NumberList.size();
+            if (!NumberSize1 || !NumberSize2) {
+                NumberResult.NumberList.clear();
+                NumberResult.NumberSignature = true;
+                return;
+            }
+            bool NumberSignature = Number1.NumberSignature == Number2.NumberSignature;
+            if (NumberSize1 == 1 && NumberSize2 == 1) {
+                NumberResult.setValueNative((unsigned __int128) Number1.NumberList[0] * Number2.NumberList[0]);
+                NumberResult.NumberSignature = NumberSignature;
+                NumberResult.doNormalize();
+                return;
+            }
+            if (&NumberResult == &Number1 || &NumberResult == &Number2) {
+                thread_local LimbStorage NumberProductCache;
+                LimbStorage NumberProductList(std::move(NumberProductCache));
+                NumberProductList.resize(NumberSize1 + NumberSize2);
+                doMultiplicationKernel(NumberProductList.data(), Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+                NumberResult.NumberList.swap(NumberProductList);
+                NumberProductCache = std::move(NumberProductList);
+            } else {
+                NumberResult.NumberList.resize(NumberSize1 + NumberSize2);
+                doMultiplicationKernel(NumberResult.NumberList.data(), Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+            }
+            NumberResult.NumberSignature = NumberSignature;
+            NumberResult.doNormalize();
+        }
+
+        static void doMultiplicationModuloCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2, const Integer &NumberModulo) {
+            if (NumberModulo.NumberList.empty()) throw Exception(String(u"Integer::doMultiplicationModuloCore(Integer&, const Integer&, const Integer&, const Integer&) NumberModulo"));
+            thread_local Integer NumberProductCache;
+            Integer NumberProduct(std::move(NumberProductCache));
+            doMultiplicationCore(NumberProduct, Number1, Number2);
+            bool NumberSignature = NumberProduct.NumberSignature;
+            doDivisionCore(NumberProduct, NumberModulo, nullptr, &NumberProduct);
+            NumberResult.NumberList.swap(NumberProduct.NumberList);
+            NumberResult.NumberSignature = NumberSignature;
+            NumberResult.doNormalize();
+            NumberProductCache = std::move(NumberProduct);
+        }
+
+        static Integer doRootCore(const Integer &NumberSource, uintmax_t NumberDegree) noexcept {
+            if (NumberSource.NumberList.size() <= 2 && NumberDegree == 2) {
+                unsigned __int128 NumberValue = NumberSource.getValueNative();
+                double NumberEstimate = std::sqrt((double) NumberValue);
+                uint64_t NumberRoot = NumberEstimate >= 18446744073709551615.0 ? std::numeric_limits<uint64_t>::max() : (uint64_t) NumberEstimate;
+                if (NumberRoot) NumberRoot = (uint64_t) std::min((NumberRoot + NumberValue / NumberRoot) >> 1, (unsigned __int128) std::numeric_limits<uint64_t>::max());
+                while ((unsigned __int128) NumberRoot * NumberRoot > NumberValue) --NumberRoot;
+                while (NumberRoot < std::numeric_limits<uint64_t>::max() && (unsigned __int128) (NumberRoot + 1) * (NumberRoot + 1) <= NumberValue) ++NumberRoot;
+                return NumberRoot;
+            }
+            size_t NumberBitCount = NumberSource.getBitLength();
+            if (NumberBitCount <= NumberDegree) return NumberBitCount ? 1 : 0;
+            size_t NumberShift = (NumberBitCount - 1) / (NumberDegree << 1);
+            Integer NumberResult, NumberNext;
+            if (NumberShift) NumberResult = doRootCore(NumberSource.doShiftRight(NumberShift * NumberDegree), NumberDegree).doAddition(1).doShiftLeft(NumberShift);
+            else NumberResult = Integer(1).doShiftLeft((NumberBitCount + NumberDegree - 1) / NumberDegree);
+            for (;;) {
+                if (NumberDegree == 2) NumberNext = std::move(NumberSource.doDivision(NumberResult).doAdditionAssign(NumberResult).doShiftRightAssign(1));
+                else NumberNext = std::move(NumberSource.doDivision(NumberResult.doPower(NumberDegree - 1)).doAdditionAssign(NumberResult.doMultiplication(NumberDegree - 1)).doDivisionAssign(NumberDegree));
+                if (NumberNext.doCompare(NumberResult) >= 0) return NumberResult;
+                NumberResult.doAssign(std::move(NumberNext));
+            }
+        }
+
+        Integer doShiftLimb(intmax_t NumberShift) const noexcept {
+            Integer NumberResult;
+            if (NumberList.empty() || (NumberShift < 0 && (size_t) -NumberShift >= NumberList.size())) return NumberResult;
+            if (NumberShift >= 0) {
+                NumberResult.NumberList.resize(NumberList.size() + NumberShift);
+                std::copy(NumberList.begin(), NumberList.end(), NumberResult.NumberList.begin() + NumberShift);
+            } else NumberResult.NumberList.assign(NumberList.begin() - NumberShift, NumberList.end());
+            NumberResult.NumberSignature = NumberSignature;
+            return NumberResult;
+        }
+
+        uint64_t getBitWindow(size_t NumberShift) const noexcept {
+            size_t NumberPart = NumberShift >> 6;
+            if (NumberPart >= NumberList.size()) return 0;
+            uint64_t NumberResult = NumberList[NumberPart] >> (NumberShift & 63);
+            if ((NumberShift & 63) && NumberPart + 1 < NumberList.size()) NumberResult |= NumberList[NumberPart + 1] << (64 - (NumberShift & 63));
+            return NumberResult;
+        }
+
+        Integer getLimbLow(size_t NumberSize) const noexcept {
+            return {NumberList.data(), std::min(NumberSize, NumberList.size())};
+        }
+
+        unsigned __int128 getValueNative() const noexcept {
+            if (NumberList.empty()) return 0;
+            return NumberList.size() == 1 ? NumberList[0] : (unsigned __int128) NumberList[1] << 64 | NumberList[0];
+        }
+
+        void setValueNative(unsigned __int128 NumberValue, bool NumberCarry = false) noexcept {
+            NumberList.resize(2 + NumberCarry);
+            NumberList[0] = (uint64_t) NumberValue;
+            NumberList[1] = (uint64_t) (NumberValue >> 64);
+            if (NumberCarry) NumberList[2] = 1;
+        }
+
+        void doNormalize() noexcept {
+            while (!NumberList.empty() && !NumberList.back()) NumberList.pop_back();
+            if (NumberList.empty()) NumberSignature = true;
+        }
+
+        template<typename F>
+        static Integer doPowerWindow(const Integer &NumberBase, const Integer &NumberExponent, const Integer &NumberOne, F doMultiplicationStep) {
+            if (NumberExponent.NumberList.empty()) return NumberOne;
+            size_t NumberBitCount = NumberExponent.getBitLength();
+            unsigned short NumberWindow = NumberBitCount > 671 ? 6 : NumberBitCount > 239 ? 5 : NumberBitCount > 79 ? 4 : NumberBitCount > 23 ? 3 : NumberBitCount > 7 ? 2 : 1;
+            std::vector<Integer> NumberTable(1, NumberBase);
+            if (NumberWindow > 1) {
+                Integer NumberSquare(NumberBase);
+                doMultiplicationStep(NumberSquare, NumberSquare);
+                NumberTable.reserve((size_t) 1 << (NumberWindow - 1));
+                while (NumberTable.size() < NumberTable.capacity()) {
+                    NumberTable.push_back(NumberTable.back());
+                    doMultiplicationStep(NumberTable.back(), NumberSquare);
+                }
+            }
+            Integer NumberResult;
+            bool NumberInitial = true;
+            for (size_t NumberBit = NumberBitCount; NumberBit > 0;) {
+                if (!NumberExponent.isBitSet(NumberBit - 1)) {
+                    doMultiplicationStep(NumberResult, NumberResult);
+                    --NumberBit;
+                    continue;
+                }
+                size_t NumberBitLow = NumberBit > NumberWindow ? NumberBit - NumberWindow : 0, NumberWindowValue = 0;
+                while (!NumberExponent.isBitSet(NumberBitLow)) ++NumberBitLow;
+                for (size_t NumberBitCurrent = NumberBit; NumberBitCurrent-- > NumberBitLow;) {
+                    NumberWindowValue = NumberWindowValue << 1 | NumberExponent.isBitSet(NumberBitCurrent);
+                    if (!NumberInitial) doMultiplicationStep(NumberResult, NumberResult);
+                }
+                if (NumberInitial) NumberResult = NumberTable[NumberWindowValue >> 1], NumberInitial = false;
+                else doMultiplicationStep(NumberResult, NumberTable[NumberWindowValue >> 1]);
+                NumberBit = NumberBitLow;
+            }
+            return NumberResult;
+        }
+
+        static void doFormatChunk(const Integer &NumberSource, size_t NumberLevel, uint64_t *NumberChunkList, std::vector<Integer> &NumberPowerList, uint64_t NumberChunkBase) {
+            if (NumberSource.NumberList.empty()) return;
+            if (!NumberLevel) {
+                doFormatChunkBasecase(NumberSource, NumberChunkList, NumberChunkBase);
+                return;
+            }
+            Integer NumberQuotient, NumberRemainder;
+            doDivisionCore(NumberSource, getConversionPower(NumberPowerList, NumberLevel - 1, NumberChunkBase), &NumberQuotient, &NumberRemainder);
+            doFormatChunk(NumberRemainder, NumberLevel - 1, NumberChunkList, NumberPowerList, NumberChunkBase);
+            doFormatChunk(NumberQuotient, NumberLevel - 1, NumberChunkList + (NumberConversionThreshold << (NumberLevel - 1)), NumberPowerList, NumberChunkBase);
+        }
+
+        static void doFormatChunkBasecase(const Integer &NumberSource, uint64_t *NumberChunkList, uint64_t NumberChunkBase) noexcept {
+            thread_local std::vector<uint64_t> NumberCurrent;
+            NumberCurrent.assign(NumberSource.NumberList.begin(), NumberSource.NumberList.end());
+            while (!NumberCurrent.empty()) {
+                *NumberChunkList++ = doDivisionLimbKernel(NumberCurrent.data(), NumberCurrent.data(), NumberCurrent.size(), NumberChunkBase);
+                while (!NumberCurrent.empty() && !NumberCurrent.back()) NumberCurrent.pop_back();
+            }
+        }
+
+        static Integer doParseChunk(const uint64_t *NumberChunkList, size_t NumberChunkCount, std::vector<Integer> &NumberPowerList, uint64_t NumberChunkBase) {
+            if (NumberChunkCount <= NumberConversionThreshold) {
+                Integer NumberResult;
+                NumberResult.NumberList.resize(NumberChunkCount);
+                size_t NumberSize = 0;
+                for (size_t NumberChunk = NumberChunkCount; NumberChunk-- > 0;) {
+                    uint64_t NumberCarry = NumberChunkList[NumberChunk];
+                    for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                        unsigned __int128 NumberCurrent = (unsigned __int128) NumberResult.NumberList[NumberPart] * NumberChunkBase + NumberCarry;
+                        NumberResult.NumberList[NumberPart] = (uint64_t) NumberCurrent;
+                        NumberCarry = (uint64_t) (NumberCurrent >> 64);
+                    }
+                    if (NumberCarry) NumberResult.NumberList[NumberSize++] = NumberCarry;
+                }
+                NumberResult.NumberList.resize(NumberSize);
+                return NumberResult;
+            }
+            size_t NumberLevel = 0;
+            while ((NumberConversionThreshold << (NumberLevel + 1)) < NumberChunkCount) ++NumberLevel;
+            size_t NumberChunkCountLow = NumberConversionThreshold << NumberLevel;
+            Integer NumberResult(doParseChunk(NumberChunkList + NumberChunkCountLow, NumberChunkCount - NumberChunkCountLow, NumberPowerList, NumberChunkBase));
+            doMultiplicationCore(NumberResult, NumberResult, getConversionPower(NumberPowerList, NumberLevel, NumberChunkBase));
+            return std::move(NumberResult.doAdditionAssign(doParseChunk(NumberChunkList, NumberChunkCountLow, NumberPowerList, NumberChunkBase)));
+        }
+
+        static const Integer &getConversionPower(std::vector<Integer> &NumberPowerList, size_t NumberLevel, uint64_t NumberChunkBase) noexcept {
+            if (NumberPowerList.empty()) NumberPowerList.push_back(Integer(NumberChunkBase).doPower(NumberConversionThreshold));
+            while (NumberPowerList.size() <= NumberLevel) NumberPowerList.push_back(NumberPowerList.back().doMultiplication(NumberPowerList.back()));
+            return NumberPowerList[NumberLevel];
+        }
+
+        static unsigned short getRadixDigitCount(unsigned short NumberRadix) noexcept {
+            unsigned short NumberDigitCount = 0;
+            for (uint64_t NumberPower = 1; NumberPower <= std::numeric_limits<uint64_t>::max() / NumberRadix; NumberPower *= NumberRadix) ++NumberDigitCount;
+            return NumberDigitCount;
+        }
+
+        static unsigned short getRadixDigitValue(char16_t NumberCharacter) noexcept {
+            if (NumberCharacter >= u'0' && NumberCharacter <= u'9') return NumberCharacter - u'0';
+            if (NumberCharacter >= u'A' && NumberCharacter <= u'Z') return NumberCharacter - u'A' + 10;
+            if (NumberCharacter >= u'a' && NumberCharacter <= u'z') return NumberCharacter - u'a' + 10;
+            return 36;
+        }
+    public:
+        class ScratchScope final {
+        private:
+            LimbArena::LimbChunk *NumberPrevious;
+        public:
+            ScratchScope() noexcept : NumberPrevious(LimbArena::doEnter()) {}
+
+            ScratchScope(const ScratchScope&) = delete;
+
+            ~ScratchScope() noexcept {
+                LimbArena::doLeave(NumberPrevious);
+            }
+
+            ScratchScope &operator=(const ScratchScope&) = delete;
+        };
+
+        Integer() noexcept : NumberSignature(true) {}
+
+        template<std::signed_integral T>
+        Integer(T NumberValue) noexcept : NumberSignature(NumberValue >= 0) {
+            auto NumberMagnitude = (std::make_unsigned_t<T>) NumberValue;
+            if (!NumberSignature) NumberMagnitude = -NumberMagnitude;
+            for (; NumberMagnitude; NumberMagnitude = sizeof(T) > sizeof(uint64_t) ? NumberMagnitude >> 32 >> 32 : 0)
+                NumberList.push_back((uint64_t) NumberMagnitude);
+        }
+
+        template<std::unsigned_integral T>
+        Integer(T NumberValue) noexcept : NumberSignature(true) {
+            for (; NumberValue; NumberValue = sizeof(T) > sizeof(uint64_t) ? NumberValue >> 32 >> 32 : 0)
+                NumberList.push_back((uint64_t) NumberValue);
+        }
+
+        Integer(const Integer&) = default;
+
+        Integer(Integer &&NumberSource) noexcept : NumberSignature(NumberSource.NumberSignature), NumberList(std::move(NumberSource.NumberList)) {
+            NumberSource.NumberSignature = true;
+        }
+
+        Integer(const String &NumberValue, unsigned short NumberRadix = 10) : NumberSignature(true) {
+            if (NumberRadix < 2 || NumberRadix > 36)
+                throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberRadix"));
+            if (NumberValue.isEmpty())
+                throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
+            intmax_t NumberDigit = 0;
+            if (NumberValue.getCharacter(0) == u'-' || NumberValue.getCharacter(0) == u'+') NumberSignature = NumberValue.getCharacter(NumberDigit++) == u'+';
+            if (NumberDigit == NumberValue.getCharacterSize())
+                throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
+            std::u16string NumberString(NumberValue.toU16String());
+            size_t NumberDigitCount = NumberString.size() - NumberDigit;
+            if (!(NumberRadix & (NumberRadix - 1))) {
+                unsigned short NumberRadixBit = std::countr_zero(NumberRadix);
+                NumberList.resize((NumberDigitCount * NumberRadixBit + 63) >> 6);
+                size_t NumberBit = 0;
+                for (size_t NumberIndex = NumberString.size(); NumberIndex-- > (size_t) NumberDigit; NumberBit += NumberRadixBit) {
+                    uint64_t NumberDigitValue = getRadixDigitValue(NumberString[NumberIndex]);
+                    if (NumberDigitValue >= NumberRadix)
+                        throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
+                    NumberList[NumberBit >> 6] |= NumberDigitValue << (NumberBit & 63);
+                    if ((NumberBit & 63) + NumberRadixBit > 64) NumberList[(NumberBit >> 6) + 1] |= NumberDigitValue >> (64 - (NumberBit & 63));
+                }
+            } else {
+                unsigned short NumberChunkSize = getRadixDigitCount(NumberRadix);
+                uint64_t NumberChunkBase = 1;
+                for (unsigned short NumberChunkDigit = 0; NumberChunkDigit < NumberChunkSize; ++NumberChunkDigit) NumberChunkBase *= NumberRadix;
+                std::vector<uint64_t> NumberChunkList((NumberDigitCount + NumberChunkSize - 1) / NumberChunkSize);
+                size_t NumberIndex = NumberDigit;
+                for (size_t NumberChunk = NumberChunkList.size(); NumberChunk-- > 0;) {
+                    size_t NumberIndexEnd = NumberString.size() - NumberChunk * NumberChunkSize;
+                    for (; NumberIndex < NumberIndexEnd; ++NumberIndex) {
+                        unsigned short NumberDigitValue = getRadixDigitValue(NumberString[NumberIndex]);
+                        if (NumberDigitValue >= NumberRadix)
+                            throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
+                        NumberChunkList[NumberChunk] = NumberChunkList[NumberChunk] * NumberRadix + NumberDigitValue;
+                    }
+                }
+                std::vector<Integer> NumberPowerList;
+                NumberList = std::move(doParseChunk(NumberChunkList.data(), NumberChunkList.size(), NumberPowerList, NumberChunkBase).NumberList);
+            }
+            doNormalize();
+        }
+
+        Integer doAddition(const Integer &NumberOther) const & noexcept {
+            Integer NumberResult;
+            doAdditionCore(NumberResult, *this, NumberOther, NumberOther.NumberSignature);
+            return NumberResult;
+        }
+
+        Integer doAddition(const Integer &NumberOther) && noexcept {
+            return std::move(doAdditionAssign(NumberOther));
+        }
+
+        Integer &doAdditionAssign(const Integer &NumberOther) noexcept {
+            doAdditionCore(*this, *this, NumberOther, NumberOther.NumberSignature);
+            return *this;
+        }
+
+        Integer doBitwiseAnd(const Integer &NumberOther) const noexcept {
+            Integer NumberResult;
+            doBitwiseCore(NumberResult, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 & Number2;
+            });
+            return NumberResult;
+        }
+
+        Integer &doBitwiseAndAssign(const Integer &NumberOther) noexcept {
+            doBitwiseCore(*this, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 & Number2;
+            });
+            return *this;
+        }
+
+        Integer doBitwiseOr(const Integer &NumberOther) const noexcept {
+            Integer NumberResult;
+            doBitwiseCore(NumberResult, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 | Number2;
+            });
+            return NumberResult;
+        }
+
+        Integer &doBitwiseOrAssign(const Integer &NumberOther) noexcept {
+            doBitwiseCore(*this, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 | Number2;
+            });
+            return *this;
+        }
+
+        Integer doBitwiseXor(const Integer &NumberOther) const noexcept {
+            Integer NumberResult;
+            doBitwiseCore(NumberResult, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 ^ Number2;
+            });
+            return NumberResult;
+        }
+
+        Integer &doBitwiseXorAssign(const Integer &NumberOther) noexcept {
+            doBitwiseCore(*this, *this, NumberOther, [](uint64_t Number1, uint64_t Number2) {
+                return Number1 ^ Number2;
+            });
+            return *this;
+        }
+
+        void doAssign(const Integer &NumberSource) noexcept {
+            if (&NumberSource == this) return;
+            NumberSignature = NumberSource.NumberSignature;
+            NumberList.assign(NumberSource.NumberList.begin(), NumberSource.NumberList.end());
+        }
+
+        void doAssign(Integer &&NumberSource) noexcept {
+            if (&NumberSource == this) return;
+            NumberSignature = NumberSource.NumberSignature;
+            NumberList = std::move(NumberSource.NumberList);
+            NumberSource.NumberSignature = true;
+            NumberSource.NumberList.clear();
+        }
+
+        intmax_t doCompare(const Integer &NumberOther) const noexcept {
+            if (NumberSignature != NumberOther.NumberSignature && (!NumberList.empty() || !NumberOther.NumberList.empty()))
+                return NumberSignature ? 1 : -1;
+            intmax_t NumberRelation = doCompareKernel(NumberList.data(), NumberList.size(), NumberOther.NumberList.data(), NumberOther.NumberList.size());
+            return NumberSignature ? NumberRelation : -NumberRelation;
+        }
+
+        Integer doDivision(const Integer &NumberOther) const & {
+            Integer NumberQuotient;
+            doDivisionCore(*this, NumberOther, &NumberQuotient, nullptr);
+            NumberQuotient.NumberSignature = NumberSignature == NumberOther.NumberSignature;
+            NumberQuotient.doNormalize();
+            return NumberQuotient;
+        }
+
+        Integer doDivision(const Integer &NumberOther) && {
+            return std::move(doDivisionAssign(NumberOther));
+        }
+
+        Integer &doDivisionAssign(const Integer &NumberOther) {
+            bool NumberSignatureQuotient = NumberSignature == NumberOther.NumberSignature;
+            doDivisionCore(*this, NumberOther, this, nullptr);
+            NumberSignature = NumberSignatureQuotient;
+            doNormalize();
+            return *this;
+        }
+
+        std::pair<Integer, Integer> doDivisionModulo(const Integer &NumberOther) const {
+            Integer NumberQuotient, NumberRemainder;
+            doDivisionCore(*this, NumberOther, &NumberQuotient, &NumberRemainder);
+            NumberQuotient.NumberSignature = NumberSignature == NumberOther.NumberSignature;
+            NumberRemainder.NumberSignature = NumberSignature;
+            NumberQuotient.doNormalize();
+            NumberRemainder.doNormalize();
+            return {std::move(NumberQuotient), std::move(NumberRemainder)};
+        }
+
+        Integer doModulo(const Integer &NumberOther) const & {
+            Integer NumberRemainder;
+            doDivisionCore(*this, NumberOther, nullptr, &NumberRemainder);
+            NumberRemainder.NumberSignature = NumberSignature;
+            NumberRemainder.doNormalize();
+            return NumberRemainder;
+        }
+
+        Integer doModulo(const Integer &NumberOther) && {
+            return std::move(doModuloAssign(NumberOther));
+        }
+
+        Integer &doModuloAssign(const Integer &NumberOther) {
+            bool NumberSignatureRemainder = NumberSignature;
+            doDivisionCore(*this, NumberOther, nullptr, this);
+            NumberSignature = NumberSignatureRemainder;
+            doNormalize();
+            return *this;
+        }
+
+        Integer doMultiplication(const Integer &NumberOther) const & noexcept {
+            Integer NumberResult;
+            doMultiplicationCore(NumberResult, *this, NumberOther);
+            return NumberResult;
+        }
+
+        Integer doMultiplication(const Integer &NumberOther) && noexcept {
+            return std::move(doMultiplicationAssign(NumberOther));
+        }
+
+        Integer doMultiplicationAddition(const Integer &NumberMultiplier, const Integer &NumberAddend) const & noexcept {
+            Integer NumberResult;
+            doMultiplicationAdditionCore(NumberResult, *this, NumberMultiplier, NumberAddend, NumberAddend.NumberSignature);
+            return NumberResult;
+        }
+
+        Integer doMultiplicationAddition(const Integer &NumberMultiplier, const Integer &NumberAddend) && noexcept {
+            return std::move(doMultiplicationAdditionAssign(NumberMultiplier, NumberAddend));
+        }
+
+        Integer &doMultiplicationAdditionAssign(const Integer &NumberMultiplier, const Integer &NumberAddend) noexcept {
+            doMultiplicationAdditionCore(*this, *this, NumberMultiplier, NumberAddend, NumberAddend.NumberSignature);
+            return *this;
+        }
+
+        Integer &doMultiplicationAssign(const Integer &NumberOther) noexcept {
+            doMultiplicationCore(*this, *this, NumberOther);
+            return *this;
+        }
+
+        Integer doMultiplicationModulo(const Integer &NumberMultiplier, const Integer &NumberModulo) const & {
+            Integer NumberResult;
+            doMultiplicationModuloCore(NumberResult, *this, NumberMultiplier, NumberModulo);
+            return NumberResult;
+        }
+
+        Integer doMultiplicationModulo(const Integer &NumberMultiplier, const Integer &NumberModulo) && {
+            return std::move(doMultiplicationModuloAssign(NumberMultiplier, NumberModulo));
+        }
+
+        Integer &doMultiplicationModuloAssign(const Integer &NumberMultiplier, const Integer &NumberModulo) {
+            doMultiplicationModuloCore(*this, *this, NumberMultiplier, NumberModulo);
+            return *this;
+        }
+
+        Integer doMultiplicationNTT(const Integer &NumberOther) const noexcept {
+            Integer NumberResult;
+            if (NumberList.empty() || NumberOther.NumberList.empty()) return NumberResult;
+            NumberResult.NumberList.resize(NumberList.size() + NumberOther.NumberList.size());
+            doMultiplicationNTT(NumberResult.NumberList.data(), NumberList.data(), NumberList.size(), NumberOther.NumberList.data(), NumberOther.NumberList.size());
+            NumberResult.NumberSignature = NumberSignature == NumberOther.NumberSignature;
+            NumberResult.doNormalize();
+            return NumberResult;
+        }
+
+        Integer doMultiplicationSubtraction(const Integer &NumberMultiplier, const Integer &NumberSubtrahend) const & noexcept {
+            Integer NumberResult;
+            doMultiplicationAdditionCore(NumberResult, *this, NumberMultiplier, NumberSubtrahend, !NumberSubtrahend.NumberSignature);
+            return NumberResult;
+        }
+
+        Integer doMultiplicationSubtraction(const Integer &NumberMultiplier, const Integer &NumberSubtrahend) && noexcept {
+            return std::move(doMultiplicationSubtractionAssign(NumberMultiplier, NumberSubtrahend));
+        }
+
+        Integer &doMultiplicationSubtractionAssign(const Integer &NumberMultiplier, const Integer &NumberSubtrahend) noexcept {
+            doMultiplicationAdditionCore(*this, *this, NumberMultiplier, NumberSubtrahend, !NumberSubtrahend.NumberSignature);
+            return *this;
+        }
+
+        Integer doPower(const Integer &NumberExponent) const noexcept {
+            return doPowerWindow(*this, NumberExponent, 1, [](Integer &NumberTarget, const Integer &NumberSource) {
+                NumberTarget.doMultiplicationAssign(NumberSource);
+            });
+        }
+
+        Integer doPower(const Integer &NumberExponent, const Integer &NumberModulo) const;
+
+        Integer doShiftLeft(uintmax_t NumberShift) const & noexcept {
+            Integer NumberResult(*this);
+            return std::move(NumberResult.doShiftLeftAssign(NumberShift));
+        }
+
+        Integer doShiftLeft(uintmax_t NumberShift) && noexcept {
+            return std::move(doShiftLeftAssign(NumberShift));
+        }
+
+        Integer &doShiftLeftAssign(uintmax_t NumberShift) noexcept {
+            if (NumberList.empty() || !NumberShift) return *this;
+            size_t NumberSize = NumberList.size(), NumberShiftLimb = NumberShift >> 6;
+            NumberList.resize(NumberSize + NumberShiftLimb + 1);
+            NumberList[NumberSize + NumberShiftLimb] = doShiftLeftKernel(NumberList.data() + NumberShiftLimb, NumberList.data(), NumberSize, (unsigned short) (NumberShift & 63));
+            std::fill(NumberList.begin(), NumberList.begin() + NumberShiftLimb, 0);
+            doNormalize();
+            return *this;
+        }
+
+        Integer doShiftRight(uintmax_t NumberShift) const & noexcept {
+            if (NumberShift >> 6 >= NumberList.size()) return {};
+            Integer NumberResult;
+            NumberResult.NumberList.resize(NumberList.size() - (size_t) (NumberShift >> 6));
+            doShiftRightKernel(NumberResult.NumberList.data(), NumberList.data() + (NumberShift >> 6), NumberResult.NumberList.size(), (unsigned short) (NumberShift & 63));
+            NumberResult.NumberSignature = NumberSignature;
+            NumberResult.doNormalize();
+            return NumberResult;
+        }
+
+        Integer doShiftRight(uintmax_t NumberShift) && noexcept {
+            return std::move(doShiftRightAssign(NumberShift));
+        }
+
+        Integer &doShiftRightAssign(uintmax_t NumberShift) noexcept {
+            if (!NumberShift) return *this;
+            if (NumberShift >> 6 >= NumberList.size()) {
+                NumberList.clear();
+                NumberSignature = true;
+                return *this;
+            }
+            size_t NumberSize = NumberList.size() - (size_t) (NumberShift >> 6);
+            doShiftRightKernel(NumberList.data(), NumberList.data() + (NumberShift >> 6), NumberSize, (unsigned short) (NumberShift & 63));
+            NumberList.resize(NumberSize);
+            doNormalize();
+            return *this;
+        }
+
+        Integer doSquareSubtraction(const Integer &NumberSubtrahend) const & noexcept {
+            Integer NumberResult;
+            doMultiplicationAdditionCore(NumberResult, *this, *this, NumberSubtrahend, !NumberSubtrahend.NumberSignature);
+            return NumberResult;
+        }
+
+        Integer doSquareSubtraction(const Integer &NumberSubtrahend) && noexcept {
+            return std::move(doSquareSubtractionAssign(NumberSubtrahend));
+        }
+
+        Integer &doSquareSubtractionAssign(const Integer &NumberSubtrahend) noexcept {
+            doMultiplicationAdditionCore(*this, *this, *this, NumberSubtrahend, !NumberSubtrahend.NumberSignature);
+            return *this;
+        }
+
+        Integer doSubtraction(const Integer &NumberOther) const & noexcept {
+            Integer NumberResult;
+            doAdditionCore(NumberResult, *this, NumberOther, !NumberOther.NumberSignature);
+            return NumberResult;
+        }
+
+        Integer doSubtraction(const Integer &NumberOther) && noexcept {
+            return std::move(doSubtractionAssign(NumberOther));
+        }
+
+        Integer &doSubtractionAssign(const Integer &NumberOther) noexcept {
+            doAdditionCore(*this, *this, NumberOther, !NumberOther.NumberSignature);
+            return *this;
+        }
+
+        Integer getAbsolute() const & noexcept {
+            Integer NumberResult(*this);
+            NumberResult.NumberSignature = true;
+            return NumberResult;
+        }
+
+        Integer getAbsolute() && noexcept {
+            NumberSignature = true;
+            return std::move(*this);
+        }
+
+        size_t getBitLength() const noexcept {
+            return NumberList.empty() ? 0 : (NumberList.size() << 6) - std::countl_zero(NumberList.back());
+        }
+
+        Integer getGreatestCommonFactor(const Integer &NumberOther) const noexcept {
+            return doGreatestCommonFactorCore(*this, NumberOther, nullptr);
+        }
+
+        std::tuple<Integer, Integer, Integer> getGreatestCommonFactorExtended(const Integer &NumberOther) const noexcept {
+            Integer NumberCoefficient1, NumberCoefficient2, NumberFactor(doGreatestCommonFactorCore(*this, NumberOther, &NumberCoefficient1));
+            if (!NumberOther.NumberList.empty()) NumberCoefficient2 = NumberFactor.doSubtraction(getAbsolute().doMultiplication(NumberCoefficient1)).doDivision(NumberOther.getAbsolute());
+            if (!NumberSignature) NumberCoefficient1 = NumberCoefficient1.getOpposite();
+            if (!NumberOther.NumberSignature) NumberCoefficient2 = NumberCoefficient2.getOpposite();
+            return {std::move(NumberFactor), std::move(NumberCoefficient1), std::move(NumberCoefficient2)};
+        }
+
+        Integer getInverseModulo(const Integer &NumberModulo) const {
+            if (!NumberModulo.isPositive()) throw Exception(String(u"Integer::getInverseModulo(const Integer&) NumberModulo"));
+            Integer NumberSource(doModulo(NumberModulo)), NumberCoefficient;
+            if (NumberSource.isNegative()) NumberSource.doAdditionAssign(NumberModulo);
+            if (doGreatestCommonFactorCore(NumberSource, NumberModulo, &NumberCoefficient).doCompare(1))
+                throw Exception(String(u"Integer::getInverseModulo(const Integer&) NumberModulo"));
+            NumberCoefficient.doModuloAssign(NumberModulo);
+            if (NumberCoefficient.isNegative()) NumberCoefficient.doAdditionAssign(NumberModulo);
+            return NumberCoefficient;
+        }
+
+        Integer getRoot(uintmax_t NumberDegree) const {
+            if (!NumberDegree || (!NumberSignature && !(NumberDegree & 1))) throw Exception(String(u"Integer::getRoot(uintmax_t) NumberDegree"));
+            if (NumberDegree == 1) return *this;
+            Integer NumberResult(doRootCore(getAbsolute(), NumberDegree));
+            if (!NumberSignature) NumberResult = NumberResult.getOpposite();
+            return NumberResult;
+        }
+
+        Integer getOpposite() const & noexcept {
+            Integer NumberResult(*this);
+            NumberResult.NumberSignature = !NumberSignature || NumberList.empty();
+            return NumberResult;
+        }
+
+        Integer getOpposite() && noexcept {
+            NumberSignature = !NumberSignature || NumberList.empty();
+            return std::move(*this);
+        }
+
+        size_t getTrailingZeroCount() const noexcept {
+            size_t NumberPart = 0;
+            while (NumberPart < NumberList.size() && !NumberList[NumberPart]) ++NumberPart;
+            return NumberPart == NumberList.size() ? 0 : (NumberPart << 6) + std::countr_zero(NumberList[NumberPart]);
+        }
+
+        Integer getSquareRoot() const {
+            if (!NumberSignature) throw Exception(String(u"Integer::getSquareRoot() NumberSignature"));
+            return doRootCore(*this, 2);
+        }
+
+        intmax_t getValue() const {
+            if (NumberList.size() > 1 || (!NumberList.empty() && NumberList[0] > (uint64_t) std::numeric_limits<intmax_t>::max() + !NumberSignature))
+                throw Exception(String(u"Integer::getValue() Number value out of limits"));
+            if (NumberList.empty()) return 0;
+            return NumberSignature ? (intmax_t) NumberList[0] : (intmax_t) (0 - NumberList[0]);
+        }
+
+        bool isBitSet(size_t NumberBit) const noexcept {
+            return (NumberBit >> 6) < NumberList.size() && (NumberList[NumberBit >> 6] >> (NumberBit & 63) & 1);
+        }
+
+        bool isEven() const noexcept {
+            return NumberList.empty() || !(NumberList[0] & 1);
+        }
+
+        bool isNegative() const noexcept {
+            return !NumberList.empty() && !NumberSignature;
+        }
+
+        bool isOdd() const noexcept {
+            return !NumberList.empty() && (NumberList[0] & 1);
+        }
+
+        bool isPerfectSquare() const noexcept {
+            if (!NumberSignature) return false;
+            if (NumberList.empty()) return true;
+            if (!(0x0202021202030213 >> (NumberList[0] & 63) & 1)) return false;
+            unsigned __int128 NumberResidue = 0;
+            for (size_t NumberPart = NumberList.size(); NumberPart-- > 0;) NumberResidue = (NumberResidue << 64 | NumberList[NumberPart]) % 45045;
+            if (!(0x0402483012450293 >> (NumberResidue % 63) & 1) || !(((unsigned __int128) 1 << 64 | 0x218A019866014613) >> (NumberResidue % 65) & 1) || !(0x23B >> (NumberResidue % 11) & 1)) return false;
+            Integer NumberRoot(doRootCore(*this, 2));
+            return !NumberRoot.doMultiplication(NumberRoot).doCompare(*this);
+        }
+
+        bool isPositive() const noexcept {
+            return !NumberList.empty() && NumberSignature;
+        }
+
+        Integer &operator=(const Integer &NumberSource) noexcept {
+            doAssign(NumberSource);
+            return *this;
+        }
+
+        Integer &operator=(Integer &&NumberSource) noexcept {
+            doAssign(std::move(NumberSource));
+            return *this;
+        }
+
+        static void setParallelism(size_t NumberThreadCount, size_t NumberThreshold = 1024) {
+            if (!NumberThreadCount) throw Exception(String(u"Integer::setParallelism(size_t, size_t) NumberThreadCount"));
+            NumberParallelThreshold.store(std::max(NumberThreshold, NumberKaratsubaThreshold), std::memory_order_relaxed);
+            NumberParallelAvailable.fetch_add((intmax_t) NumberThreadCount - (intmax_t) NumberParallelCount.exchange(NumberThreadCount), std::memory_order_release);
+        }
+
+        String toString() const noexcept override {
+            return toString(10);
+        }
+
+        String toString(unsigned short NumberRadix) const {
+            if (NumberRadix < 2 || NumberRadix > 36) throw Exception(String(u"Integer::toString(unsigned short) NumberRadix"));
+            if (NumberList.empty()) return String(u'0');
+            std::u16string CharacterString;
+            if (!(NumberRadix & (NumberRadix - 1))) {
+                unsigned short NumberRadixBit = std::countr_zero(NumberRadix);
+                size_t NumberDigitCount = (getBitLength() + NumberRadixBit - 1) / NumberRadixBit;
+                CharacterString.resize(NumberDigitCount);
+                for (size_t NumberDigit = 0, NumberBit = 0; NumberDigit < NumberDigitCount; ++NumberDigit, NumberBit += NumberRadixBit) {
+                    uint64_t NumberDigitValue = NumberList[NumberBit >> 6] >> (NumberBit & 63);
+                    if ((NumberBit & 63) + NumberRadixBit > 64 && (NumberBit >> 6) + 1 < NumberList.size()) NumberDigitValue |= NumberList[(NumberBit >> 6) + 1] << (64 - (NumberBit & 63));
+                    CharacterString[NumberDigitCount - NumberDigit - 1] = NumberDigitTable[NumberDigitValue & (NumberRadix - 1)];
+                }
+            } else {
+                unsigned short NumberChunkSize = getRadixDigitCount(NumberRadix);
+                uint64_t NumberChunkBase = 1;
+                for (unsigned short NumberChunkDigit = 0; NumberChunkDigit < NumberChunkSize; ++NumberChunkDigit) NumberChunkBase *= NumberRadix;
+                std::vector<uint64_t> NumberChunkList;
+                if (NumberList.size() < NumberConversionThreshold) {
+                    NumberChunkList.resize(NumberList.size() * 2 + 1);
+                    doFormatChunkBasecase(*this, NumberChunkList.data(), NumberChunkBase);
+                } else {
+                    Integer NumberSource(getAbsolute());
+                    std::vector<Integer> NumberPowerList;
+                    size_t NumberLevel = 0;
+                    while (getConversionPower(NumberPowerList, NumberLevel, NumberChunkBase).doCompare(NumberSource) <= 0) ++NumberLevel;
+                    NumberChunkList.resize(NumberConversionThreshold << NumberLevel);
+                    doFormatChunk(NumberSource, NumberLevel, NumberChunkList.data(), NumberPowerList, NumberChunkBase);
+                }
+                while (!NumberChunkList.back()) NumberChunkList.pop_back();
+                CharacterString.resize(NumberChunkList.size() * NumberChunkSize);
+                auto CharacterIterator = CharacterString.end();
+                for (uint64_t NumberChunk : NumberChunkList)
+                    for (unsigned short NumberChunkDigit = 0; NumberChunkDigit < NumberChunkSize; ++NumberChunkDigit) {
+                        *--CharacterIterator = NumberDigitTable[NumberChunk % NumberRadix];
+                        NumberChunk /= NumberRadix;
+                    }
+                CharacterString.erase(0, CharacterString.find_first_not_of(u'0'));
+            }
+            if (!NumberSignature) CharacterString.insert(CharacterString.begin(), u'-');
+            return {CharacterString};
+        }
+    };
+
+    class MontgomeryContext final : public Object {
+    private:
+        Integer NumberModulo, NumberOne, NumberSquare;
+        uint64_t NumberInverse;
+        size_t NumberSize;
+
+        void doCheck(const Integer &NumberSource, const char16_t *NumberMethod) const {
+            if (NumberSource.isNegative() || NumberSource.doCompare(NumberModulo) >= 0)
+                throw Exception(String(u"MontgomeryContext::").doConcat(String(NumberMethod)));
+        }
+
+        void doMultiplicationCore(Integer &NumberResult, const Integer &Number1, const Integer &Number2) const noexcept {
+            thread_local std::vector<uint64_t> NumberBuffer;
+            NumberBuffer.resize(NumberSize << 2);
+            uint64_t *NumberOperand1 = NumberBuffer.data(), *NumberOperand2 = NumberOperand1 + NumberSize, *NumberProduct = NumberOperand2 + NumberSize;
+            std::fill(std::copy(Number1.NumberList.begin(), Number1.NumberList.end(), NumberOperand1), NumberOperand1 + NumberSize, 0);
+            if (&Number1 == &Number2) NumberOperand2 = NumberOperand1;
+            else std::fill(std::copy(Number2.NumberList.begin(), Number2.NumberList.end(), NumberOperand2), NumberOperand2 + NumberSize, 0);
+            Integer::doMultiplicationKernel(NumberProduct, NumberOperand1, NumberSize, NumberOperand2, NumberSize);
+            Integer::doReductionMontgomeryKernel(NumberOperand1, NumberProduct, NumberModulo.NumberList.data(), NumberSize, NumberInverse);
+            NumberResult.NumberList.assign(NumberOperand1, NumberOperand1 + NumberSize);
+            NumberResult.NumberSignature = true;
+            NumberResult.doNormalize();
+        }
+    public:
+        explicit MontgomeryContext(const Integer &NumberModuloSource) : NumberModulo(NumberModuloSource) {
+            if (NumberModulo.isEven() || NumberModulo.doCompare(1) <= 0)
+                throw Exception(String(u"MontgomeryContext::MontgomeryContext(const Integer&) NumberModuloSource"));
+            NumberSize = NumberModulo.NumberList.size();
+            NumberInverse = 0 - Integer::getInverseLimb(NumberModulo.NumberList[0]);
+            NumberOne = Integer(1).doShiftLeftAssign(NumberSize << 6).doModuloAssign(NumberModulo);
+            NumberSquare = Integer(1).doShiftLeftAssign(NumberSize << 7).doModuloAssign(NumberModulo);
+        }
+
+        Integer &doAdditionAssign(Integer &Number1, const Integer &Number2) const {
+            doCheck(Number1, u"doAdditionAssign(Integer&, const Integer&) Number1");
+            doCheck(Number2, u"doAdditionAssign(Integer&, const Integer&) Number2");
+            if (Number1.doAdditionAssign(Number2).doCompare(NumberModulo) >= 0) Number1.doSubtractionAssign(NumberModulo);
+            return Number1;
+        }
+
+        Integer doMultiplication(const Integer &Number1, const Integer &Number2) const {
+            doCheck(Number1, u"doMultiplication(const Integer&, const Integer&) Number1");
+            doCheck(Number2, u"doMultiplication(const Integer&, const Integer&) Number2");
+            Integer NumberResult;
+            doMultiplicationCore(NumberResult, Number1, Number2);
+            return NumberResult;
+        }
+
+        Integer &doMultiplicationAssign(Integer &Number1, const Integer &Number2) const {
+            doCheck(Number1, u"doMultiplicationAssign(Integer&, const Integer&) Number1");
+            doCheck(Number2, u"doMultiplicationAssign(Integer&, const Integer&) Number2");
+            doMultiplicationCore(Number1, Number1, Number2);
+            return Number1;
+        }
+
+        Integer doPower(const Integer &NumberBase, const Integer &NumberExponent) const {
+            doCheck(NumberBase, u"doPower(const Integer&, const Integer&) NumberBase");
+            return Integer::doPowerWindow(NumberBase, NumberExponent, NumberOne, [this](Integer &NumberTarget, const Integer &NumberSource) {
+                doMultiplicationCore(NumberTarget, NumberTarget, NumberSource);
+            });
+        }
+
+        Integer doSquare(const Integer &NumberSource) const {
+            doCheck(NumberSource, u"doSquare(const Integer&) NumberSource");
+            Integer NumberResult;
+            doMultiplicationCore(NumberResult, NumberSource, NumberSource);
+            return NumberResult;
+        }
+
+        Integer &doSquareAssign(Integer &NumberSource) const {
+            doCheck(NumberSource, u"doSquareAssign(Integer&) NumberSource");
+            doMultiplicationCore(NumberSource, NumberSource, NumberSource);
+            return NumberSource;
+        }
+
+        Integer &doSubtractionAssign(Integer &Number1, const Integer &Number2) const {
+            doCheck(Number1, u"doSubtractionAssign(Integer&, const Integer&) Number1");
+            doCheck(Number2, u"doSubtractionAssign(Integer&, const Integer&) Number2");
+            if (Number1.doSubtractionAssign(Number2).isNegative()) Number1.doAdditionAssign(NumberModulo);
+            return Number1;
+        }
+
+        const Integer &getModulo() const noexcept {
+            return NumberModulo;
+        }
+
+        Integer fromMontgomery(const Integer &NumberSource) const {
+            doCheck(NumberSource, u"fromMontgomery(const Integer&) NumberSource");
+            Integer NumberResult;
+            doMultiplicationCore(NumberResult, NumberSource, Integer(1));
+            return NumberResult;
+        }
+
+        Integer toMontgomery(const Integer &NumberSource) const {
+            Integer NumberResult(NumberSource.doModulo(NumberModulo));
+            if (NumberResult.isNegative()) NumberResult.doAdditionAssign(NumberModulo);
+            doMultiplicationCore(NumberResult, NumberResult, NumberSquare);
+            return NumberResult;
+        }
+
+        String toString() const noexcept override {
+            return NumberModulo.toString();
+        }
+    };
+
+    inline Integer Integer::doPower(const Integer &NumberExponent, const Integer &NumberModulo) const {
+        if (!isNegative() && NumberModulo.isOdd() && NumberModulo.doCompare(1) > 0) {
+            MontgomeryContext NumberContext(NumberModulo);
+            return NumberContext.fromMontgomery(NumberContext.doPower(NumberContext.toMontgomery(*this), NumberExponent));
+        }
+        if (NumberExponent.NumberList.empty()) return 1;
+        return doPowerWindow(doModulo(NumberModulo), NumberExponent, 1, [&NumberModulo](Integer &NumberTarget, const Integer &NumberSource) {
+            NumberTarget.doMultiplicationModuloAssign(NumberSource, NumberModulo);
+        });
+    }
+
+    class IntegerAccumulator final : public Object {
+    private:
+        std::vector<uint64_t> NumberCarryList[2], NumberList[2];
+        uint64_t NumberPending;
+
+        void doAdditionCore(const uint64_t *NumberSource, size_t NumberSize, bool NumberSignature) noexcept {
+            uint64_t *NumberCarry = doPrepare(NumberSize, NumberSignature), *NumberTarget = NumberList[!NumberSignature].data();
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart)
+                NumberCarry[NumberPart] += (NumberTarget[NumberPart] += NumberSource[NumberPart]) < NumberSource[NumberPart];
+        }
+
+        void doFold() noexcept {
+            for (unsigned short NumberSide = 0; NumberSide < 2; ++NumberSide) {
+                std::vector<uint64_t> &NumberCarry = NumberCarryList[NumberSide], &NumberTarget = NumberList[NumberSide];
+                unsigned __int128 NumberCurrent = 0;
+                for (size_t NumberPart = 0; NumberPart < NumberTarget.size(); ++NumberPart) {
+                    NumberCurrent += NumberTarget[NumberPart];
+                    if (NumberPart) NumberCurrent += NumberCarry[NumberPart - 1];
+                    NumberTarget[NumberPart] = (uint64_t) NumberCurrent;
+                    NumberCurrent >>= 64;
+                }
+                if (!NumberTarget.empty()) NumberCurrent += NumberCarry.back();
+                for (; NumberCurrent; NumberCurrent >>= 64) NumberTarget.push_back((uint64_t) NumberCurrent);
+                NumberCarry.assign(NumberTarget.size(), 0);
+            }
+            NumberPending = 0;
+        }
+
+        void doMultiplicationAdditionCore(const Integer &Number1, const Integer &Number2, bool NumberSignature) noexcept {
+            size_t NumberSize1 = Number1.NumberList.size(), NumberSize2 = Number2.NumberList.size();
+            if (!NumberSize1 || !NumberSize2) return;
+            if (NumberSize1 == 1 && NumberSize2 == 1) {
+                unsigned __int128 NumberProduct = (unsigned __int128) Number1.NumberList[0] * Number2.NumberList[0];
+                uint64_t NumberSource[2] = {(uint64_t) NumberProduct, (uint64_t) (NumberProduct >> 64)};
+                doAdditionCore(NumberSource, 2, NumberSignature);
+                return;
+            }
+            thread_local std::vector<uint64_t> NumberBuffer;
+            NumberBuffer.resize(NumberSize1 + NumberSize2);
+            Integer::doMultiplicationKernel(NumberBuffer.data(), Number1.NumberList.data(), NumberSize1, Number2.NumberList.data(), NumberSize2);
+            doAdditionCore(NumberBuffer.data(), NumberSize1 + NumberSize2 - !NumberBuffer.back(), NumberSignature);
+        }
+
+        uint64_t *doPrepare(size_t NumberSize, bool NumberSignature) noexcept {
+            if (NumberPending == std::numeric_limits<uint64_t>::max()) doFold();
+            ++NumberPending;
+            if (NumberList[!NumberSignature].size() < NumberSize) {
+                NumberCarryList[!NumberSignature].resize(NumberSize);
+                NumberList[!NumberSignature].resize(NumberSize);
+            }
+            return NumberCarryList[!NumberSignature].data();
+        }
+
+        static Integer getMagnitude(const std::vector<uint64_t> &NumberCarry, const std::vector<uint64_t> &NumberSource) noexcept {
+            Integer NumberResult(NumberSource.data(), NumberSource.size());
+            if (std::any_of(NumberCarry.begin(), NumberCarry.end(), [](uint64_t NumberPart) {return NumberPart;})) {
+                Integer NumberCarryObject(NumberCarry.data(), NumberCarry.size());
+                NumberResult.doAdditionAssign(NumberCarryObject.doShiftLeftAssign(64));
+            }
+            return NumberResult;
+        }
+    public:
+        IntegerAccumulator() noexcept : NumberPending(0) {}
+
+        IntegerAccumulator &doAdditionAssign(const Integer &NumberSource) noexcept {
+            doAdditionCore(NumberSource.NumberList.data(), NumberSource.NumberList.size(), NumberSource.NumberSignature);
+            return *this;
+        }
+
+        void doClear() noexcept {
+            for (unsigned short NumberSide = 0; NumberSide < 2; ++NumberSide) {
+                NumberCarryList[NumberSide].clear();
+                NumberList[NumberSide].clear();
+            }
+            NumberPending = 0;
+        }
+
+        IntegerAccumulator &doMultiplicationAdditionAssign(const Integer &Number1, const Integer &Number2) noexcept {
+            doMultiplicationAdditionCore(Number1, Number2, Number1.NumberSignature == Number2.NumberSignature);
+            return *this;
+        }
+
+        IntegerAccumulator &doMultiplicationSubtractionAssign(const Integer &Number1, const Integer &Number2) noexcept {
+            doMultiplicationAdditionCore(Number1, Number2, Number1.NumberSignature != Number2.NumberSignature);
+            return *this;
+        }
+
+        IntegerAccumulator &doSubtractionAssign(const Integer &NumberSource) noexcept {
+            if (!NumberSource.NumberList.empty()) doAdditionCore(NumberSource.NumberList.data(), NumberSource.NumberList.size(), !NumberSource.NumberSignature);
+            return *this;
+        }
+
+        Integer getValue() const noexcept {
+            return getMagnitude(NumberCarryList[0], NumberList[0]).doSubtraction(getMagnitude(NumberCarryList[1], NumberList[1]));
+        }
+
+        String toString() const noexcept override {
+            return getValue().toString();
+        }
+    };
+
+    class Fraction final : public Object {
+    private:
+        bool NumberReduced, NumberSignature;
+        Integer NumberDenominator, NumberNumerator;
+        size_t NumberLazySize;
+
+        static constexpr size_t NumberLazyThreshold = 16;
+
+        Fraction(Integer &&NumberNumeratorSource, Integer &&NumberDenominatorSource, bool NumberSignatureSource, bool NumberReducedSource, size_t NumberLazySizeSource) noexcept : NumberReduced(NumberReducedSource), NumberSignature(NumberSignatureSource), NumberDenominator(std::move(NumberDenominatorSource)), NumberNumerator(std::move(NumberNumeratorSource)), NumberLazySize(NumberLazySizeSource) {
+            if (!NumberNumerator.doCompare(0)) {
+                NumberDenominator = 1;
+                NumberReduced = NumberSignature = true;
+            } else if (!NumberReduced && (!NumberLazySize || getSize() > NumberLazySize)) {
+                doReduce();
+                if (NumberLazySize) NumberLazySize = std::max(NumberLazyThreshold, getSize() << 1);
+            }
+        }
+
+        Fraction doAdditionCore(const Fraction &NumberOther, bool NumberSignatureOther) const noexcept {
+            size_t NumberLazySizeResult = std::max(NumberLazySize, NumberOther.NumberLazySize);
+            if (NumberLazySizeResult || !NumberReduced || !NumberOther.NumberReduced) {
+                Integer NumberResult(NumberNumerator.doMultiplication(NumberOther.NumberDenominator));
+                if (!NumberSignature) NumberResult = std::move(NumberResult).getOpposite();
+                NumberResult = NumberSignatureOther ? NumberOther.NumberNumerator.doMultiplicationAddition(NumberDenominator, NumberResult) : NumberOther.NumberNumerator.doMultiplicationSubtraction(NumberDenominator, NumberResult).getOpposite();
+                bool NumberSignatureResult = !NumberResult.isNegative();
+                return {std::move(NumberResult).getAbsolute(), NumberDenominator.doMultiplication(NumberOther.NumberDenominator), NumberSignatureResult, false, NumberLazySizeResult};
+            }
+            Integer NumberFactor(NumberDenominator.getGreatestCommonFactor(NumberOther.NumberDenominator));
+            bool NumberFactorUnit = !NumberFactor.doCompare(1);
+            Integer NumberDenominator1(NumberFactorUnit ? NumberDenominator : NumberDenominator.doDivision(NumberFactor)), NumberDenominator2(NumberFactorUnit ? NumberOther.NumberDenominator : NumberOther.NumberDenominator.doDivision(NumberFactor));
+            Integer NumberResult(NumberNumerator.doMultiplication(NumberDenominator2));
+            if (!NumberSignature) NumberResult = std::move(NumberResult).getOpposite();
+            NumberResult = NumberSignatureOther ? NumberOther.NumberNumerator.doMultiplicationAddition(NumberDenominator1, NumberResult) : NumberOther.NumberNumerator.doMultiplicationSubtraction(NumberDenominator1, NumberResult).getOpposite();
+            bool NumberSignatureResult = !NumberResult.isNegative();
+            NumberResult = std::move(NumberResult).getAbsolute();
+            if (NumberFactorUnit) return {std::move(NumberResult), std::move(NumberDenominator1.doMultiplicationAssign(NumberOther.NumberDenominator)), NumberSignatureResult, true, NumberLazySizeResult};
+            Integer NumberFactorResult(NumberResult.getGreatestCommonFactor(NumberFactor));
+            if (NumberFactorResult.doCompare(1)) {
+                NumberResult.doDivisionAssign(NumberFactorResult);
+                NumberDenominator1.doMultiplicationAssign(NumberOther.NumberDenominator.doDivision(NumberFactorResult));
+            } else NumberDenominator1.doMultiplicationAssign(NumberOther.NumberDenominator);
+            return {std::move(NumberResult), std::move(NumberDenominator1), NumberSignatureResult, true, NumberLazySizeResult};
+        }
+
+        Fraction doMultiplicationCore(const Integer &NumberNumeratorOther, const Integer &NumberDenominatorOther, bool NumberSignatureOther, bool NumberReducedOther, size_t NumberLazySizeOther) const noexcept {
+            bool NumberSignatureResult = NumberSignature == NumberSignatureOther;
+            size_t NumberLazySizeResult = std::max(NumberLazySize, NumberLazySizeOther);
+            if (NumberLazySizeResult || !NumberReduced || !NumberReducedOther) return {NumberNumerator.doMultiplication(NumberNumeratorOther), NumberDenominator.doMultiplication(NumberDenominatorOther), NumberSignatureResult, false, NumberLazySizeResult};
+            Integer NumberFactor1(NumberNumerator.getGreatestCommonFactor(NumberDenominatorOther)), NumberFactor2(NumberNumeratorOther.getGreatestCommonFactor(NumberDenominator));
+            Integer NumberNumeratorResult(NumberFactor1.doCompare(1) > 0 ? NumberNumerator.doDivision(NumberFactor1) : NumberNumerator), NumberDenominatorResult(NumberFactor2.doCompare(1) > 0 ? NumberDenominator.doDivision(NumberFactor2) : NumberDenominator);
+            NumberNumeratorResult.doMultiplicationAssign(NumberFactor2.doCompare(1) > 0 ? NumberNumeratorOther.doDivision(NumberFactor2) : NumberNumeratorOther);
+            NumberDenominatorResult.doMultiplicationAssign(NumberFactor1.doCompare(1) > 0 ? NumberDenominatorOther.doDivision(NumberFactor1) : NumberDenominatorOther);
+            return {std::move(NumberNumeratorResult), std::move(NumberDenominatorResult), NumberSignatureResult, true, NumberLazySizeResult};
+        }
+
+        static unsigned __int128 getLeading(const Integer &NumberSource, intmax_t &NumberExponent) noexcept {
+            size_t NumberSize = NumberSource.NumberList.size();
+            auto NumberShift = (unsigned short) std::countl_zero(NumberSource.NumberList[NumberSize - 1]);
+            unsigned __int128 NumberLeading = (unsigned __int128) NumberSource.NumberList[NumberSize - 1] << 64 | (NumberSize > 1 ? NumberSource.NumberList[NumberSize - 2] : 0);
+            NumberLeading <<= NumberShift;
+            if (NumberShift && NumberSize > 2) NumberLeading |= NumberSource.NumberList[NumberSize - 3] >> (64 - NumberShift);
+            NumberExponent = (intmax_t) (NumberSize << 6) - NumberShift - 128;
+            return NumberLeading;
+        }
+
+        template<std::floating_point T>
+        static T getRounded(unsigned __int128 NumberSource, intmax_t NumberScale, bool NumberSticky, bool NumberExact, bool NumberSignatureSource) noexcept {
+            auto NumberExponent = (intmax_t) (128 - (NumberSource >> 64 ? std::countl_zero((uint64_t) (NumberSource >> 64)) : 64 + std::countl_zero((uint64_t) NumberSource))) - 1 - NumberScale;
+            intmax_t NumberPrecision = std::numeric_limits<T>::digits;
+            if (NumberExponent < std::numeric_limits<T>::min_exponent - 1) NumberPrecision -= std::numeric_limits<T>::min_exponent - 1 - NumberExponent;
+            if (NumberPrecision < 0) return NumberSignatureSource ? T(0) : -T(0);
+            intmax_t NumberDrop = NumberExponent + NumberScale - NumberPrecision;
+            if (NumberDrop < (NumberExact ? 0 : 3)) return std::numeric_limits<T>::quiet_NaN();
+            unsigned __int128 NumberRemainder = NumberSource & (((unsigned __int128) 1 << NumberDrop) - 1), NumberMantissa = NumberSource >> NumberDrop;
+            if (!NumberExact && (NumberRemainder < 4 || NumberRemainder + 2 > (unsigned __int128) 1 << NumberDrop)) return std::numeric_limits<T>::quiet_NaN();
+            NumberSticky = NumberSticky || NumberRemainder || !NumberExact;
+            bool NumberRound = NumberMantissa & 1;
+            NumberMantissa >>= 1;
+            if (NumberRound && (NumberSticky || NumberMantissa & 1)) ++NumberMantissa;
+            T NumberResult = std::ldexp((T) NumberMantissa, (int) (NumberExponent - NumberPrecision + 1));
+            return NumberSignatureSource ? NumberResult : -NumberResult;
+        }
+
+
+        void doReduce() noexcept {
+            Integer NumberFactor(NumberDenominator.getGreatestCommonFactor(NumberNumerator));
+            if (NumberFactor.doCompare(1) > 0) {
+                NumberDenominator.doDivisionAssign(NumberFactor);
+                NumberNumerator.doDivisionAssign(NumberFactor);
+            }
+            NumberReduced = true;
+        }
+
+        size_t getSize() const noexcept {
+            return (NumberDenominator.getBitLength() + NumberNumerator.getBitLength() + 63) >> 6;
+        }
+    public:
+        Fraction(const Integer &NumberValueSource) noexcept : NumberReduced(true), NumberSignature(!NumberValueSource.isNegative()), NumberDenominator(1), NumberNumerator(NumberValueSource.getAbsolute()), NumberLazySize(0) {}
+
+        Fraction(const Integer &NumberNumeratorSource, const Integer &NumberDenominatorSource) noexcept : Fraction(NumberNumeratorSource.getAbsolute(), NumberDenominatorSource.getAbsolute(), NumberNumeratorSource.isNegative() == NumberDenominatorSource.isNegative(), false, 0) {}
+
+        Fraction doAddition(const Fraction &NumberOther) const noexcept {
+            return doAdditionCore(NumberOther, NumberOther.NumberSignature);
+        }
+
+        intmax_t doCompare(const Fraction &NumberOther) const noexcept {
+            if (NumberSignature != NumberOther.NumberSignature) return NumberSignature ? 1 : -1;
+            if (NumberNumerator.NumberList.empty() || NumberOther.NumberNumerator.NumberList.empty()) return (intmax_t) NumberOther.NumberNumerator.NumberList.empty() - (intmax_t) NumberNumerator.NumberList.empty();
+            intmax_t NumberExponentDenominator1, NumberExponentDenominator2, NumberExponentNumerator1, NumberExponentNumerator2;
+            double NumberLeading1 = (double) (uint64_t) (getLeading(NumberNumerator, NumberExponentNumerator1) >> 64) / (double) (uint64_t) (getLeading(NumberDenominator, NumberExponentDenominator1) >> 64), NumberLeading2 = (double) (uint64_t) (getLeading(NumberOther.NumberNumerator, NumberExponentNumerator2) >> 64) / (double) (uint64_t) (getLeading(NumberOther.NumberDenominator, NumberExponentDenominator2) >> 64);
+            intmax_t NumberExponent = NumberExponentNumerator1 - NumberExponentDenominator1 - NumberExponentNumerator2 + NumberExponentDenominator2;
+            if (NumberExponent > 1) return NumberSignature ? 1 : -1;
+            if (NumberExponent < -1) return NumberSignature ? -1 : 1;
+            double NumberRatio = std::ldexp(NumberLeading1 / NumberLeading2, (int) NumberExponent);
+            if (NumberRatio > 1 + 0x1p-40) return NumberSignature ? 1 : -1;
+            if (NumberRatio < 1 - 0x1p-40) return NumberSignature ? -1 : 1;
+            intmax_t NumberResult = NumberNumerator.doMultiplication(NumberOther.NumberDenominator).doCompare(NumberDenominator.doMultiplication(NumberOther.NumberNumerator));
+            return NumberSignature ? NumberResult : -NumberResult;
+        }
+
+        Fraction doDivision(const Fraction &NumberOther) const {
+            if (!NumberOther.NumberNumerator.doCompare(0)) throw Exception(String(u"Fraction::doDivision(const Fraction&) NumberOther"));
+            return doMultiplicationCore(NumberOther.NumberDenominator, NumberOther.NumberNumerator, NumberOther.NumberSignature, NumberOther.NumberReduced, NumberOther.NumberLazySize);
+        }
+
+        Fraction doMultiplication(const Fraction &NumberOther) const noexcept {
+            return doMultiplicationCore(NumberOther.NumberNumerator, NumberOther.NumberDenominator, NumberOther.NumberSignature, NumberOther.NumberReduced, NumberOther.NumberLazySize);
+        }
+
+        Fraction doMultiplicationAddition(const Fraction &NumberMultiplier, const Fraction &NumberAddend) const noexcept {
+            return doMultiplication(NumberMultiplier).doAdditionCore(NumberAddend, NumberAddend.NumberSignature);
+        }
+
+        Fraction doMultiplicationSubtraction(const Fraction &NumberMultiplier, const Fraction &NumberSubtrahend) const noexcept {
+            return doMultiplication(NumberMultiplier).doAdditionCore(NumberSubtrahend, !NumberSubtrahend.NumberSignature);
+        }
+
+        Fraction &doNormalize() noexcept {
+            if (!NumberReduced) doReduce();
+            return *this;
+        }
+
+        Fraction doSubtraction(const Fraction &NumberOther) const noexcept {
+            return doAdditionCore(NumberOther, !NumberOther.NumberSignature);
+        }
+
+        Fraction getAbsolute() const noexcept {
+            Fraction NumberResult(*this);
+            NumberResult.NumberSignature = true;
+            return NumberResult;
+        }
+
+        Integer getDenominator() const noexcept {
+            if (NumberReduced) return NumberDenominator;
+            return NumberDenominator.doDivision(NumberDenominator.getGreatestCommonFactor(NumberNumerator));
+        }
+
+        Integer getNumerator() const noexcept {
+            if (NumberReduced) return NumberNumerator;
+            return NumberNumerator.doDivision(NumberDenominator.getGreatestCommonFactor(NumberNumerator));
+        }
+
+        Fraction getOpposite() const noexcept {
+            Fraction NumberResult(*this);
+            if (NumberNumerator.doCompare(0)) NumberResult.NumberSignature = !NumberSignature;
+            return NumberResult;
+        }
+
+        template<std::floating_point T = double>
+        T getValue() const noexcept {
+            if (NumberNumerator.NumberList.empty()) return 0;
+            intmax_t NumberExponent = (intmax_t) NumberNumerator.getBitLength() - (intmax_t) NumberDenominator.getBitLength();
+            if (NumberExponent - 1 > std::numeric_limits<T>::max_exponent) return NumberSignature ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+            if (NumberExponent < std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - 2) return NumberSignature ? T(0) : -T(0);
+            intmax_t NumberExponentDenominator, NumberExponentNumerator;
+            unsigned __int128 NumberLeadingNumerator = getLeading(NumberNumerator, NumberExponentNumerator);
+            auto NumberLeadingDenominator = (uint64_t) (getLeading(NumberDenominator, NumberExponentDenominator) >> 64);
+            bool NumberExact = NumberNumerator.NumberList.size() <= 2 && NumberDenominator.NumberList.size() == 1;
+            T NumberResult = getRounded<T>(NumberLeadingNumerator / NumberLeadingDenominator, NumberExponentDenominator + 64 - NumberExponentNumerator, NumberLeadingNumerator % NumberLeadingDenominator, NumberExact, NumberSignature);
+            if (!std::isnan(NumberResult)) return NumberResult;
+            intmax_t NumberScale = std::numeric_limits<T>::digits + 2 - NumberExponent;
+            auto [NumberQuotient, NumberRemainder] = NumberScale >= 0 ? NumberNumerator.doShiftLeft(NumberScale).doDivisionModulo(NumberDenominator) : NumberNumerator.doDivisionModulo(NumberDenominator.doShiftLeft(-NumberScale));
+            unsigned __int128 NumberSource = 0;
+            for (size_t NumberPart = NumberQuotient.NumberList.size(); NumberPart-- > 0;) NumberSource = NumberSource << 64 | NumberQuotient.NumberList[NumberPart];
+            return getRounded<T>(NumberSource, NumberScale, !NumberRemainder.NumberList.empty(), true, NumberSignature);
+        }
+
+        bool isLazy() const noexcept {
+            return NumberLazySize;
+        }
+
+        bool isNegative() const noexcept {
+            return !NumberSignature;
+        }
+
+        bool isPositive() const noexcept {
+            return NumberSignature && NumberNumerator.doCompare(0);
+        }
+
+        Fraction &setLazy(bool NumberLazy) noexcept {
+            if (NumberLazy) NumberLazySize = std::max(NumberLazyThreshold, getSize() << 1);
+            else {
+                NumberLazySize = 0;
+                doNormalize();
+            }
+            return *this;
+        }
+
+        String toDecimalString(unsigned NumberDigitCount) const noexcept {
+            auto [NumberQuotient, NumberRemainder] = NumberNumerator.doMultiplication(Integer(10).doPower(NumberDigitCount)).doDivisionModulo(NumberDenominator);
+            if (NumberRemainder.doShiftLeftAssign(1).doCompare(NumberDenominator) >= 0) NumberQuotient.doAdditionAssign(1);
+            std::u16string NumberString(NumberQuotient.toString().toU16String());
+            if (NumberString.size() <= NumberDigitCount) NumberString.insert(0, NumberDigitCount + 1 - NumberString.size(), u'0');
+            if (NumberDigitCount) NumberString.insert(NumberString.size() - NumberDigitCount, 1, u'.');
+            if (!NumberSignature && NumberQuotient.doCompare(0)) NumberString.insert(0, 1, u'-');
+            return NumberString;
+        }
+
+        String toString() const noexcept override {
+            std::basic_stringstream<char16_t> StringStream;
+            if (!NumberSignature) StringStream << u'-';
+            StringStream << getNumerator().toString().toU16String() << u'/' << getDenominator().toString().toU16String();
+            return StringStream.str();
+        }
+    };
 
-    class Integer final : public Object {
+    class BigFloat final : public Object {
     private:
-        bool NumberSignature;
-        std::vector<intmax_t> NumberList;
+        intmax_t NumberExponent;
+        Integer NumberMantissa;
+        size_t NumberPrecision;
 
-        template<std::signed_integral T>
-        static T getAbsolute(T NumberSource) noexcept {
-            return NumberSource >= 0 ? NumberSource : -NumberSource;
+        BigFloat(Integer &&NumberMantissaSource, intmax_t NumberExponentSource, size_t NumberPrecisionSource, bool NumberSticky) noexcept : NumberExponent(NumberExponentSource), NumberMantissa(std::move(NumberMantissaSource)), NumberPrecision(NumberPrecisionSource) {
+            doRound(NumberSticky);
         }
 
-        template<std::unsigned_integral T>
-        static T getAbsolute(T NumberSource) noexcept {
-            return NumberSource;
+        BigFloat doAdditionCore(const BigFloat &NumberOther, bool NumberSignatureOther) const noexcept {
+            size_t NumberPrecisionResult = std::max(NumberPrecision, NumberOther.NumberPrecision);
+            if (NumberOther.NumberMantissa.NumberList.empty()) return {Integer(NumberMantissa), NumberExponent, NumberPrecisionResult, false};
+            Integer NumberMantissa1(NumberMantissa), NumberMantissa2(NumberSignatureOther ? NumberOther.NumberMantissa : NumberOther.NumberMantissa.getOpposite());
+            if (NumberMantissa.NumberList.empty()) return {std::move(NumberMantissa2), NumberOther.NumberExponent, NumberPrecisionResult, false};
+            intmax_t NumberExponent1 = NumberExponent, NumberExponent2 = NumberOther.NumberExponent, NumberTop1 = NumberExponent1 + (intmax_t) NumberMantissa1.getBitLength(), NumberTop2 = NumberExponent2 + (intmax_t) NumberMantissa2.getBitLength();
+            if (NumberTop1 < NumberTop2) {
+                std::swap(NumberMantissa1, NumberMantissa2);
+                std::swap(NumberExponent1, NumberExponent2);
+                std::swap(NumberTop1, NumberTop2);
+            }
+            intmax_t NumberFloor = std::min(NumberExponent1, NumberTop1 - (intmax_t) NumberPrecisionResult - 3);
+            if (NumberTop2 < NumberFloor) {
+                NumberMantissa2 = NumberMantissa2.isNegative() ? -1 : 1;
+                NumberExponent2 = NumberFloor - 1;
+            }
+            intmax_t NumberExponentResult = std::min(NumberExponent1, NumberExponent2);
+            NumberMantissa1.doShiftLeftAssign(NumberExponent1 - NumberExponentResult).doAdditionAssign(NumberMantissa2.doShiftLeftAssign(NumberExponent2 - NumberExponentResult));
+            return {std::move(NumberMantissa1), NumberExponentResult, NumberPrecisionResult, false};
         }
-    public:
-        constexpr Integer() noexcept : NumberSignature(true) {
-            NumberList.push_back(0);
-            static_assert(std::is_integral<decltype(NumberBaseUnit)>::value && NumberBaseUnit > 0, "Invalid NumberBaseUnit");
+
+        void doRound(bool NumberSticky) noexcept {
+            size_t NumberBitLength = NumberMantissa.getBitLength();
+            if (NumberBitLength > NumberPrecision) {
+                size_t NumberDrop = NumberBitLength - NumberPrecision;
+                bool NumberRound = NumberMantissa.isBitSet(NumberDrop - 1);
+                NumberSticky = NumberSticky || NumberMantissa.getTrailingZeroCount() < NumberDrop - 1;
+                NumberMantissa.doShiftRightAssign(NumberDrop);
+                NumberExponent += (intmax_t) NumberDrop;
+                if (NumberRound && (NumberSticky || NumberMantissa.isOdd())) NumberMantissa.doAdditionAssign(NumberMantissa.isNegative() ? -1 : 1);
+            }
+            if (NumberMantissa.NumberList.empty()) {
+                NumberExponent = 0;
+                return;
+            }
+            size_t NumberTrailing = NumberMantissa.getTrailingZeroCount();
+            NumberMantissa.doShiftRightAssign(NumberTrailing);
+            NumberExponent += (intmax_t) NumberTrailing;
         }
+    public:
+        static constexpr size_t NumberPrecisionDefault = 128;
 
-        template<std::signed_integral T>
-        Integer(T NumberValue) noexcept {
-            NumberSignature = NumberValue >= 0;
-            do {
-                NumberList.push_back(getAbsolute(NumberValue % NumberBaseUnit));
-                NumberValue /= NumberBaseUnit;
-            } while (NumberValue);
+        BigFloat() noexcept : NumberExponent(0), NumberPrecision(NumberPrecisionDefault) {}
+
+        BigFloat(const Integer &NumberMantissaSource, intmax_t NumberExponentSource = 0, size_t NumberPrecisionSource = NumberPrecisionDefault) : NumberExponent(NumberExponentSource), NumberMantissa(NumberMantissaSource), NumberPrecision(NumberPrecisionSource) {
+            if (!NumberPrecision) throw Exception(String(u"BigFloat::BigFloat(const Integer&, intmax_t, size_t) NumberPrecisionSource"));
+            doRound(false);
         }
 
-        template<std::unsigned_integral T>
-        Integer(T NumberValue) noexcept : NumberSignature(true) {
-            do {
-                NumberList.push_back(NumberValue % NumberBaseUnit);
-                NumberValue /= NumberBaseUnit;
-            } while (NumberValue);
+        explicit BigFloat(const Fraction &NumberSource, size_t NumberPrecisionSource = NumberPrecisionDefault) : NumberPrecision(NumberPrecisionSource) {
+            if (!NumberPrecision) throw Exception(String(u"BigFloat::BigFloat(const Fraction&, size_t) NumberPrecisionSource"));
+            Integer NumberDenominator(NumberSource.getDenominator()), NumberNumerator(NumberSource.getNumerator());
+            NumberExponent = (intmax_t) NumberNumerator.getBitLength() - (intmax_t) NumberDenominator.getBitLength() - (intmax_t) NumberPrecision - 2;
+            auto [NumberQuotient, NumberRemainder] = NumberExponent < 0 ? NumberNumerator.doShiftLeftAssign(-NumberExponent).doDivisionModulo(NumberDenominator) : NumberNumerator.doDivisionModulo(NumberDenominator.doShiftLeftAssign(NumberExponent));
+            NumberMantissa = NumberSource.isNegative() ? std::move(NumberQuotient).getOpposite() : std::move(NumberQuotient);
+            doRound(!NumberRemainder.NumberList.empty());
         }
 
-        Integer(const String &NumberValue, unsigned short NumberRadix = 10) : NumberSignature(true) {
-            if (NumberRadix < 2 || NumberRadix > 36)
-                throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberRadix"));
-            if (NumberValue.isEmpty())
-                throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
-            Integer IntegerRadix(NumberRadix);
-            bool NumberSignatureExist = false;
-            static std::map<char16_t, unsigned short> NumberDigitMapping;
-            if (NumberDigitMapping.empty()) {
-                for (unsigned short NumberDigit = 0; NumberDigit < 10; ++NumberDigit)
-                    NumberDigitMapping[NumberDigit + 48] = NumberDigit;
-                for (unsigned short NumberDigit = 0; NumberDigit < 26; ++NumberDigit)
-                    NumberDigitMapping[NumberDigit + 65] = NumberDigitMapping[NumberDigit + 97] = NumberDigit + 10;
-            }
-            intmax_t NumberDigit = 0;
-            for (; NumberDigit < NumberValue.getCharacterSize(); ++NumberDigit)
-                if (NumberValue.getCharacter(NumberDigit) == u'-' && NumberDigit == 0 && !NumberSignatureExist)
-                    NumberSignature = false, NumberSignatureExist = true;
-                else if (NumberValue.getCharacter(NumberDigit) == u'+' && NumberDigit == 0 && !NumberSignatureExist)
-                    NumberSignatureExist = true;
-                else if ((iswdigit(NumberValue.getCharacter(NumberDigit)) || iswalpha(NumberValue.getCharacter(NumberDigit))) && NumberDigitMapping[NumberValue.getCharacter(NumberDigit)] < NumberRadix);
-                else throw Exception(String(u"Integer::Integer(const String&, unsigned short) NumberValue"));
-            for (NumberDigit = 0; NumberDigit < NumberValue.getCharacterSize(); ++NumberDigit)
-                NumberList = doMultiplication(IntegerRadix).doAddition(NumberDigitMapping[NumberValue.getCharacter(NumberDigit)]).NumberList;
-            if (NumberList.empty()) NumberList.push_back(0);
-            while (!NumberList.back() && NumberList.size() > 1) NumberList.pop_back();
-        }
-
-        Integer doAddition(const Integer &NumberOther) const noexcept {
-            if (NumberSignature && !NumberOther.NumberSignature) return doSubtraction(NumberOther.getAbsolute());
-            if (!NumberSignature && NumberOther.NumberSignature) return NumberOther.doSubtraction(getAbsolute());
-            if (!NumberSignature && !NumberOther.NumberSignature) return getAbsolute().doAddition(NumberOther.getAbsolute()).getOpposite();
-            Integer NumberResult;
-            NumberResult.NumberList.clear();
-            intmax_t NumberCarry = 0;
-            for (size_t NumberPart = 0;; ++NumberPart) {
-                if (!NumberCarry && NumberPart >= NumberList.size() &&
-                    NumberPart >= NumberOther.NumberList.size())
-                    break;
-                intmax_t NumberCurrent = NumberCarry;
-                if (NumberPart < NumberList.size()) NumberCurrent += NumberList[NumberPart];
-                if (NumberPart < NumberOther.NumberList.size()) NumberCurrent += NumberOther.NumberList[NumberPart];
-                NumberResult.NumberList.push_back(NumberCurrent % NumberBaseUnit);
-                NumberCarry = NumberCurrent / NumberBaseUnit;
+        template<std::floating_point T>
+        explicit BigFloat(T NumberSource, size_t NumberPrecisionSource = NumberPrecisionDefault) : NumberExponent(0), NumberPrecision(NumberPrecisionSource) {
+            if (!NumberPrecision) throw Exception(String(u"BigFloat::BigFloat(T, size_t) NumberPrecisionSource"));
+            if (!std::isfinite(NumberSource)) throw Exception(String(u"BigFloat::BigFloat(T, size_t) NumberSource"));
+            int NumberExponentSource;
+            T NumberMantissaSource = std::frexp(std::abs(NumberSource), &NumberExponentSource);
+            for (int NumberDigit = 0; NumberDigit < std::numeric_limits<T>::digits; NumberDigit += 32) {
+                NumberMantissaSource = std::ldexp(NumberMantissaSource, 32);
+                T NumberChunk = std::floor(NumberMantissaSource);
+                NumberMantissa.doShiftLeftAssign(32).doAdditionAssign((uint64_t) NumberChunk);
+                NumberMantissaSource -= NumberChunk;
+                NumberExponentSource -= 32;
             }
+            if (NumberSource < 0) NumberMantissa = std::move(NumberMantissa).getOpposite();
+            NumberExponent = NumberExponentSource;
+            doRound(false);
+        }
+
+        BigFloat doAddition(const BigFloat &NumberOther) const noexcept {
+            return doAdditionCore(NumberOther, true);
+        }
+
+        intmax_t doCompare(const BigFloat &NumberOther) const noexcept {
+            bool NumberNegative1 = NumberMantissa.isNegative(), NumberNegative2 = NumberOther.NumberMantissa.isNegative();
+            if (NumberNegative1 != NumberNegative2) return NumberNegative1 ? -1 : 1;
+            if (NumberMantissa.NumberList.empty() || NumberOther.NumberMantissa.NumberList.empty()) return (intmax_t) !NumberMantissa.NumberList.empty() - (intmax_t) !NumberOther.NumberMantissa.NumberList.empty();
+            intmax_t NumberTop1 = NumberExponent + (intmax_t) NumberMantissa.getBitLength(), NumberTop2 = NumberOther.NumberExponent + (intmax_t) NumberOther.NumberMantissa.getBitLength();
+            if (NumberTop1 != NumberTop2) return (NumberTop1 > NumberTop2) == NumberNegative1 ? -1 : 1;
+            intmax_t NumberExponentMinimum = std::min(NumberExponent, NumberOther.NumberExponent);
+            return NumberMantissa.doShiftLeft(NumberExponent - NumberExponentMinimum).doCompare(NumberOther.NumberMantissa.doShiftLeft(NumberOther.NumberExponent - NumberExponentMinimum));
+        }
+
+        BigFloat doDivision(const BigFloat &NumberOther) const {
+            if (NumberOther.NumberMantissa.NumberList.empty()) throw Exception(String(u"BigFloat::doDivision(const BigFloat&) NumberOther"));
+            size_t NumberPrecisionResult = std::max(NumberPrecision, NumberOther.NumberPrecision);
+            intmax_t NumberShift = (intmax_t) NumberPrecisionResult + 2 - (intmax_t) NumberMantissa.getBitLength() + (intmax_t) NumberOther.NumberMantissa.getBitLength();
+            auto [NumberQuotient, NumberRemainder] = NumberShift > 0 ? NumberMantissa.doShiftLeft(NumberShift).doDivisionModulo(NumberOther.NumberMantissa) : NumberMantissa.doDivisionModulo(NumberOther.NumberMantissa.doShiftLeft(-NumberShift));
+            return {std::move(NumberQuotient), NumberExponent - NumberOther.NumberExponent - NumberShift, NumberPrecisionResult, !NumberRemainder.NumberList.empty()};
+        }
+
+        BigFloat doMultiplication(const BigFloat &NumberOther) const noexcept {
+            return {NumberMantissa.doMultiplication(NumberOther.NumberMantissa), NumberExponent + NumberOther.NumberExponent, std::max(NumberPrecision, NumberOther.NumberPrecision), false};
+        }
+
+        BigFloat doShiftLeft(intmax_t NumberShift) const noexcept {
+            BigFloat NumberResult(*this);
+            if (!NumberMantissa.NumberList.empty()) NumberResult.NumberExponent += NumberShift;
             return NumberResult;
         }
 
-        intmax_t doCompare(const Integer &NumberOther) const noexcept {
-            if (NumberSignature != NumberOther.NumberSignature && (NumberList.size() != 1 || NumberList[0]) && (NumberOther.NumberList.size() != 1 || NumberList[0]))
-                return (intmax_t) NumberSignature - NumberOther.NumberSignature;
-            if (NumberList.size() != NumberOther.NumberList.size())
-                return NumberSignature ? (intmax_t) NumberList.size() - NumberOther.NumberList.size() : (intmax_t) NumberOther.NumberList.size() - NumberList.size();
-            for (auto NumberPart = (intmax_t) (NumberList.size() - 1); NumberPart >= 0; --NumberPart)
-                if (NumberList[NumberPart] != NumberOther.NumberList[NumberPart])
-                    return NumberSignature ? (intmax_t) (NumberList[NumberPart]) - NumberOther.NumberList[NumberPart] :
-                           (intmax_t) (NumberOther.NumberList[NumberPart]) - NumberList[NumberPart];
-            return 0;
+        BigFloat doShiftRight(intmax_t NumberShift) const noexcept {
+            return doShiftLeft(-NumberShift);
         }
 
-        Integer doDivision(const Integer &NumberOther) const noexcept {
-            Integer NumberRemainder, NumberResult(*this);
-            NumberResult.NumberSignature = !(NumberSignature ^ NumberOther.NumberSignature);
-            for (auto NumberPart = (intmax_t) (NumberList.size() - 1); NumberPart >= 0; --NumberPart) {
-                NumberRemainder = NumberRemainder.doMultiplication(NumberBaseUnit).doAddition(NumberList[NumberPart]);
-                intmax_t NumberMiddle, NumberStart = 0, NumberStop = NumberBaseUnit - 1;
-                for (;;) {
-                    NumberMiddle = (NumberStart + NumberStop) >> 1;
-                    if (NumberOther.doMultiplication(NumberMiddle).doCompare(NumberRemainder) <= 0)
-                        if (NumberOther.doMultiplication(NumberMiddle + 1).doCompare(NumberRemainder) > 0) break;
-                        else NumberStart = NumberMiddle;
-                    else NumberStop = NumberMiddle;
-                }
-                NumberResult.NumberList[NumberPart] = NumberMiddle;
-                NumberRemainder = NumberRemainder.doSubtraction(NumberOther.doMultiplication(NumberResult.NumberList[NumberPart]));
-            }
-            while (!NumberResult.NumberList.back() && NumberResult.NumberList.size() > 1)
-                NumberResult.NumberList.pop_back();
+        BigFloat doSubtraction(const BigFloat &NumberOther) const noexcept {
+            return doAdditionCore(NumberOther, false);
+        }
+
+        BigFloat getAbsolute() const noexcept {
+            BigFloat NumberResult(*this);
+            NumberResult.NumberMantissa = std::move(NumberResult.NumberMantissa).getAbsolute();
             return NumberResult;
         }
 
-        Integer doModulo(const Integer &NumberOther) const noexcept {
-            Integer NumberRemainder, NumberResult(*this);
-            for (auto NumberPart = (intmax_t) (NumberList.size() - 1); NumberPart >= 0; --NumberPart) {
-                NumberRemainder = NumberRemainder.doMultiplication(NumberBaseUnit).doAddition(NumberList[NumberPart]);
-                intmax_t NumberMiddle, NumberStart = 0, NumberStop = NumberBaseUnit - 1;
-                for (;;) {
-                    NumberMiddle = (NumberStart + NumberStop) >> 1;
-                    if (NumberOther.doMultiplication(NumberMiddle).doCompare(NumberRemainder) <= 0)
-                        if (NumberOther.doMultiplication(NumberMiddle + 1).doCompare(NumberRemainder) > 0) break;
-                        else NumberStart = NumberMiddle;
-                    else NumberStop = NumberMiddle;
-                }
-                NumberResult.NumberList[NumberPart] = NumberMiddle;
-                Integer NumberRemainderNew = NumberRemainder.doSubtraction(NumberOther.doMultiplication(NumberResult.NumberList[NumberPart]));
-                NumberRemainder.NumberList = NumberRemainderNew.NumberList;
+        intmax_t getExponent() const noexcept {
+            return NumberExponent;
+        }
+
+        Integer getMantissa() const noexcept {
+            return NumberMantissa;
+        }
+
+        BigFloat getOpposite() const noexcept {
+            BigFloat NumberResult(*this);
+            NumberResult.NumberMantissa = std::move(NumberResult.NumberMantissa).getOpposite();
+            return NumberResult;
+        }
+
+        size_t getPrecision() const noexcept {
+            return NumberPrecision;
+        }
+
+        BigFloat getSquareRoot() const {
+            if (NumberMantissa.isNegative()) throw Exception(String(u"BigFloat::getSquareRoot() NumberMantissa"));
+            if (NumberMantissa.NumberList.empty()) return *this;
+            intmax_t NumberShift = std::max((intmax_t) 0, (intmax_t) (NumberPrecision << 1) + 4 - (intmax_t) NumberMantissa.getBitLength());
+            if ((NumberExponent - NumberShift) & 1) ++NumberShift;
+            Integer NumberSource(NumberMantissa.doShiftLeft(NumberShift)), NumberRoot(NumberSource.getSquareRoot());
+            bool NumberSticky = NumberRoot.doMultiplication(NumberRoot).doCompare(NumberSource) != 0;
+            return {std::move(NumberRoot), (NumberExponent - NumberShift) / 2, NumberPrecision, NumberSticky};
+        }
+
+        template<std::floating_point T = double>
+        T getValue() const noexcept {
+            return toFraction().getValue<T>();
+        }
+
+        bool isNegative() const noexcept {
+            return NumberMantissa.isNegative();
+        }
+
+        bool isPositive() const noexcept {
+            return NumberMantissa.isPositive();
+        }
+
+        bool isZero() const noexcept {
+            return NumberMantissa.NumberList.empty();
+        }
+
+        BigFloat &setPrecision(size_t NumberPrecisionSource) {
+            if (!NumberPrecisionSource) throw Exception(String(u"BigFloat::setPrecision(size_t) NumberPrecisionSource"));
+            NumberPrecision = NumberPrecisionSource;
+            doRound(false);
+            return *this;
+        }
+
+        Fraction toFraction() const noexcept {
+            if (NumberExponent >= 0) return NumberMantissa.doShiftLeft(NumberExponent);
+            return {NumberMantissa, Integer(1).doShiftLeftAssign(-NumberExponent)};
+        }
+
+        Integer toInteger() const noexcept {
+            return NumberExponent >= 0 ? NumberMantissa.doShiftLeft(NumberExponent) : NumberMantissa.doShiftRight(-NumberExponent);
+        }
+
+        String toString() const noexcept override {
+            if (NumberMantissa.NumberList.empty()) return String(u"0");
+            auto NumberDigitCount = (intmax_t) (NumberPrecision * 30103 / 100000 + 1);
+            auto NumberDecimal = (intmax_t) std::floor((double) (NumberExponent + (intmax_t) NumberMantissa.getBitLength() - 1) * 0.30102999566398120);
+            Integer NumberDigit;
+            for (;;) {
+                intmax_t NumberScale = NumberDigitCount - 1 - NumberDecimal;
+                Integer NumberDenominator(1), NumberNumerator(NumberMantissa.getAbsolute());
+                (NumberExponent >= 0 ? NumberNumerator : NumberDenominator).doShiftLeftAssign(NumberExponent >= 0 ? NumberExponent : -NumberExponent);
+                (NumberScale >= 0 ? NumberNumerator : NumberDenominator).doMultiplicationAssign(Integer(10).doPower(NumberScale >= 0 ? NumberScale : -NumberScale));
+                auto [NumberQuotient, NumberRemainder] = NumberNumerator.doDivisionModulo(NumberDenominator);
+                if (NumberRemainder.doShiftLeftAssign(1).doCompare(NumberDenominator) >= 0) NumberQuotient.doAdditionAssign(1);
+                NumberDigit = std::move(NumberQuotient);
+                if (NumberDigit.doCompare(Integer(10).doPower(NumberDigitCount)) >= 0) ++NumberDecimal;
+                else if (NumberDigit.doCompare(Integer(10).doPower(NumberDigitCount - 1)) < 0) --NumberDecimal;
+                else break;
             }
-            NumberRemainder.NumberSignature = NumberSignature;
-            return NumberRemainder;
+            std::u16string NumberString(NumberDigit.toString().toU16String());
+            NumberString.insert(1, 1, u'.');
+            while (NumberString.back() == u'0') NumberString.pop_back();
+            if (NumberString.back() == u'.') NumberString.pop_back();
+            if (NumberMantissa.isNegative()) NumberString.insert(0, 1, u'-');
+            if (NumberDecimal) NumberString.append(u"e").append(Integer(NumberDecimal).toString().toU16String());
+            return NumberString;
         }
+    };
 
-        Integer doMultiplication(const Integer &NumberOther) const noexcept {
-            std::vector<intmax_t> NumberProduct(NumberList.size() + NumberOther.NumberList.size(), 0);
-            for (size_t NumberDigit1 = 0; NumberDigit1 < NumberList.size(); ++NumberDigit1)
-                for (size_t NumberDigit2 = 0; NumberDigit2 < NumberOther.NumberList.size(); ++NumberDigit2)
-                    NumberProduct[NumberDigit1 + NumberDigit2] +=
-                            NumberList[NumberDigit1] * NumberOther.NumberList[NumberDigit2];
-            Integer NumberResult;
-            NumberResult.NumberList.clear();
-            NumberResult.NumberSignature = !(NumberSignature ^ NumberOther.NumberSignature);
-            intmax_t NumberCarry = 0;
-            for (size_t NumberPart = 0;; ++NumberPart) {
-                if (!NumberCarry && NumberPart >= NumberProduct.size()) break;
-                intmax_t NumberCurrent = NumberProduct[NumberPart] + NumberCarry;
-                NumberResult.NumberList.push_back(NumberCurrent % NumberBaseUnit);
-                NumberCarry = NumberCurrent / NumberBaseUnit;
+    template<unsigned short NumberScale>
+    class Decimal final {
+    private:
+        static_assert(NumberScale <= 18);
+
+        intmax_t NumberValue;
+
+        static constexpr intmax_t getFactor(unsigned short NumberDigit) noexcept {
+            intmax_t NumberFactor = 1;
+            while (NumberDigit--) NumberFactor *= 10;
+            return NumberFactor;
+        }
+
+        static constexpr intmax_t NumberFactor = getFactor(NumberScale);
+
+        static constexpr __int128 doDivisionRound(__int128 NumberDividend, __int128 NumberDivisor) noexcept {
+            __int128 NumberQuotient = NumberDividend / NumberDivisor, NumberRemainder = NumberDividend % NumberDivisor;
+            if ((NumberRemainder < 0 ? -NumberRemainder : NumberRemainder) * 2 >= (NumberDivisor < 0 ? -NumberDivisor : NumberDivisor))
+                NumberQuotient += (NumberDividend < 0) == (NumberDivisor < 0) ? 1 : -1;
+            return NumberQuotient;
+        }
+
+        static constexpr __int128 doDivisionRoundFactor(__int128 NumberDividend) noexcept {
+            if (NumberDividend != (intmax_t) NumberDividend) return doDivisionRound(NumberDividend, NumberFactor);
+            return doDivisionRoundNative((intmax_t) NumberDividend, NumberFactor);
+        }
+
+        static constexpr intmax_t doDivisionRoundNative(intmax_t NumberDividend, intmax_t NumberDivisor) noexcept {
+            intmax_t NumberQuotient = NumberDividend / NumberDivisor, NumberRemainder = NumberDividend % NumberDivisor;
+            return NumberQuotient + (intmax_t) ((NumberRemainder < 0 ? -NumberRemainder : NumberRemainder) * 2 >= NumberDivisor) * (NumberDividend < 0 ? -1 : 1);
+        }
+
+        static constexpr bool isOverflow(__int128 NumberSource) noexcept {
+            return NumberSource < std::numeric_limits<intmax_t>::min() || NumberSource > std::numeric_limits<intmax_t>::max();
+        }
+
+        struct DecimalUnscaled {};
+
+        constexpr Decimal(intmax_t NumberValueSource, DecimalUnscaled) noexcept : NumberValue(NumberValueSource) {}
+    public:
+        constexpr Decimal() noexcept : NumberValue(0) {}
+
+        template<std::integral T>
+        constexpr Decimal(T NumberSource) : NumberValue(0) {
+            if (__builtin_mul_overflow(NumberSource, NumberFactor, &NumberValue)) throw Exception(String(u"Decimal<NumberScale>::Decimal(T) NumberSource"));
+        }
+
+        explicit Decimal(const Fraction &NumberSource) : NumberValue(0) {
+            auto [NumberQuotient, NumberRemainder] = NumberSource.getNumerator().doMultiplication(NumberFactor).doDivisionModulo(NumberSource.getDenominator());
+            if (NumberRemainder.doShiftLeftAssign(1).doCompare(NumberSource.getDenominator()) >= 0) NumberQuotient.doAdditionAssign(1);
+            if (NumberSource.isNegative()) NumberQuotient = NumberQuotient.getOpposite();
+            if (NumberQuotient.getBitLength() > 63 && NumberQuotient.doCompare(std::numeric_limits<intmax_t>::min())) throw Exception(String(u"Decimal<NumberScale>::Decimal(const Fraction&) NumberSource"));
+            NumberValue = NumberQuotient.getValue();
+        }
+
+        explicit Decimal(const Integer &NumberSource) : NumberValue(0) {
+            Integer NumberScaled(NumberSource.doMultiplication(NumberFactor));
+            if (NumberScaled.getBitLength() > 63 && NumberScaled.doCompare(std::numeric_limits<intmax_t>::min())) throw Exception(String(u"Decimal<NumberScale>::Decimal(const Integer&) NumberSource"));
+            NumberValue = NumberScaled.getValue();
+        }
+
+        explicit Decimal(const String &NumberSource) : NumberValue(0) {
+            std::u16string NumberString(NumberSource.toU16String());
+            size_t NumberIndex = 0;
+            bool NumberNegative = false, NumberRound = false, NumberValid = false;
+            if (NumberIndex < NumberString.size() && (NumberString[NumberIndex] == u'-' || NumberString[NumberIndex] == u'+')) NumberNegative = NumberString[NumberIndex++] == u'-';
+            __int128 NumberResult = 0;
+            for (; NumberIndex < NumberString.size() && NumberString[NumberIndex] >= u'0' && NumberString[NumberIndex] <= u'9'; ++NumberIndex, NumberValid = true) {
+                NumberResult = NumberResult * 10 + (NumberString[NumberIndex] - u'0');
+                if (NumberResult > (__int128) std::numeric_limits<intmax_t>::max() + NumberNegative) throw Exception(String(u"Decimal<NumberScale>::Decimal(const String&) NumberSource"));
             }
-            while (!NumberResult.NumberList.back() && NumberResult.NumberList.size() > 1)
-                NumberResult.NumberList.pop_back();
+            unsigned short NumberDigit = 0;
+            if (NumberIndex < NumberString.size() && NumberString[NumberIndex] == u'.') {
+                for (++NumberIndex; NumberIndex < NumberString.size() && NumberString[NumberIndex] >= u'0' && NumberString[NumberIndex] <= u'9'; ++NumberIndex, NumberValid = true) {
+                    if (NumberDigit < NumberScale) {
+                        NumberResult = NumberResult * 10 + (NumberString[NumberIndex] - u'0');
+                        ++NumberDigit;
+                    } else if (!NumberRound) {
+                        NumberRound = true;
+                        if (NumberString[NumberIndex] >= u'5') ++NumberResult;
+                    }
+                }
+            }
+            if (!NumberValid || NumberIndex != NumberString.size()) throw Exception(String(u"Decimal<NumberScale>::Decimal(const String&) NumberSource"));
+            for (; NumberDigit < NumberScale; ++NumberDigit) NumberResult *= 10;
+            if (NumberNegative) NumberResult = -NumberResult;
+            if (isOverflow(NumberResult)) throw Exception(String(u"Decimal<NumberScale>::Decimal(const String&) NumberSource"));
+            NumberValue = (intmax_t) NumberResult;
+        }
+
+        constexpr Decimal doAddition(const Decimal &NumberOther) const {
+            Decimal NumberResult;
+            if (__builtin_add_overflow(NumberValue, NumberOther.NumberValue, &NumberResult.NumberValue)) throw Exception(String(u"Decimal<NumberScale>::doAddition(const Decimal&) NumberOther"));
             return NumberResult;
         }
 
-        Integer doPower(const Integer &NumberExponentSource) const noexcept {
-            Integer NumberBase(*this), NumberExponent(NumberExponentSource), NumberResult(1);
-            while (NumberExponent.doCompare(0)) {
-                if (NumberExponent.isOdd()) NumberResult = NumberResult.doMultiplication(NumberBase);
-                NumberBase = NumberBase.doMultiplication(NumberBase);
-                NumberExponent = NumberExponent.doDivision(2);
+        constexpr Decimal &doAdditionAssign(const Decimal &NumberOther) {
+            return *this = doAddition(NumberOther);
+        }
+
+        static constexpr void doAdditionBatch(const Decimal *NumberList1, const Decimal *NumberList2, Decimal *NumberListResult, intmax_t NumberSize) {
+            uint64_t NumberOverflow = 0;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberSize; ++NumberIndex) {
+                uint64_t NumberAddend1 = (uint64_t) NumberList1[NumberIndex].NumberValue, NumberAddend2 = (uint64_t) NumberList2[NumberIndex].NumberValue, NumberSum = NumberAddend1 + NumberAddend2;
+                NumberListResult[NumberIndex].NumberValue = (intmax_t) NumberSum;
+                NumberOverflow |= (NumberAddend1 ^ NumberSum) & (NumberAddend2 ^ NumberSum);
             }
-            return NumberResult;
+            if (NumberOverflow >> 63) throw Exception(String(u"Decimal<NumberScale>::doAdditionBatch(const Decimal*, const Decimal*, Decimal*, intmax_t) NumberList2"));
+        }
+
+        constexpr intmax_t doCompare(const Decimal &NumberOther) const noexcept {
+            return (NumberValue > NumberOther.NumberValue) - (NumberValue < NumberOther.NumberValue);
+        }
+
+        constexpr Decimal doDivision(const Decimal &NumberOther) const {
+            if (!NumberOther.NumberValue) throw Exception(String(u"Decimal<NumberScale>::doDivision(const Decimal&) NumberOther"));
+            __int128 NumberResult = doDivisionRound((__int128) NumberValue * NumberFactor, NumberOther.NumberValue);
+            if (isOverflow(NumberResult)) throw Exception(String(u"Decimal<NumberScale>::doDivision(const Decimal&) NumberOther"));
+            return {(intmax_t) NumberResult, DecimalUnscaled()};
+        }
+
+        constexpr Decimal &doDivisionAssign(const Decimal &NumberOther) {
+            return *this = doDivision(NumberOther);
+        }
+
+        constexpr Decimal doMultiplication(const Decimal &NumberOther) const {
+            __int128 NumberResult = doDivisionRoundFactor((__int128) NumberValue * NumberOther.NumberValue);
+            if (isOverflow(NumberResult)) throw Exception(String(u"Decimal<NumberScale>::doMultiplication(const Decimal&) NumberOther"));
+            return {(intmax_t) NumberResult, DecimalUnscaled()};
+        }
+
+        constexpr Decimal &doMultiplicationAssign(const Decimal &NumberOther) {
+            return *this = doMultiplication(NumberOther);
         }
 
-        Integer doPower(const Integer &NumberExponentSource, const Integer &NumberModulo) const noexcept {
-            Integer NumberBase(*this), NumberExponent(NumberExponentSource), NumberResult(1);
-            while (NumberExponent.doCompare(0)) {
-                if (NumberExponent.isOdd()) NumberResult = NumberResult.doMultiplication(NumberBase).doModulo(NumberModulo);
-                NumberBase = NumberBase.doMultiplication(NumberBase).doModulo(NumberModulo);
-                NumberExponent = NumberExponent.doDivision(2);
+        static constexpr void doMultiplicationBatch(const Decimal *NumberList1, const Decimal *NumberList2, Decimal *NumberListResult, intmax_t NumberSize) {
+            bool NumberOverflow = false;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberSize; ++NumberIndex) {
+                __int128 NumberProduct = doDivisionRoundFactor((__int128) NumberList1[NumberIndex].NumberValue * NumberList2[NumberIndex].NumberValue);
+                NumberListResult[NumberIndex].NumberValue = (intmax_t) NumberProduct;
+                NumberOverflow |= isOverflow(NumberProduct);
             }
-            return NumberResult;
+            if (NumberOverflow) throw Exception(String(u"Decimal<NumberScale>::doMultiplicationBatch(const Decimal*, const Decimal*, Decimal*, intmax_t) NumberList2"));
         }
 
-        Integer doSubtraction(const Integer &NumberOther) const noexcept {
-            if (NumberSignature && !NumberOther.NumberSignature) return doAddition(NumberOther.getAbsolute());
-            if (doCompare(NumberOther) < 0) return NumberOther.doSubtraction(*this).getOpposite();
-            Integer NumberResult;
-            NumberResult.NumberList.clear();
-            intmax_t NumberBorrow = 0;
-            for (size_t NumberPart = 0;; ++NumberPart) {
-                if (!NumberBorrow && NumberPart >= NumberList.size() && NumberPart >= NumberOther.NumberList.size())
-                    break;
-                intmax_t NumberCurrent = NumberList[NumberPart] - NumberBorrow;
-                if (NumberPart < NumberOther.NumberList.size()) NumberCurrent -= NumberOther.NumberList[NumberPart];
-                if (NumberCurrent < 0) {
-                    NumberBorrow = 1;
-                    NumberCurrent += NumberBaseUnit;
-                } else NumberBorrow = 0;
-                NumberResult.NumberList.push_back(NumberCurrent);
+        constexpr Decimal doRound(unsigned short NumberDigit) const {
+            if (NumberDigit >= NumberScale) return *this;
+            intmax_t NumberUnit = getFactor(NumberScale - NumberDigit);
+            __int128 NumberResult = (__int128) doDivisionRoundNative(NumberValue, NumberUnit) * NumberUnit;
+            if (isOverflow(NumberResult)) throw Exception(String(u"Decimal<NumberScale>::doRound(unsigned short) NumberDigit"));
+            return {(intmax_t) NumberResult, DecimalUnscaled()};
+        }
+
+        static constexpr void doRoundBatch(const Decimal *NumberList, Decimal *NumberListResult, intmax_t NumberSize, unsigned short NumberDigit) {
+            if (NumberDigit >= NumberScale) {
+                std::copy(NumberList, NumberList + NumberSize, NumberListResult);
+                return;
             }
-            while (!NumberResult.NumberList.back() && NumberResult.NumberList.size() > 1)
-                NumberResult.NumberList.pop_back();
-            return NumberResult;
+            intmax_t NumberUnit = getFactor(NumberScale - NumberDigit);
+            bool NumberOverflow = false;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberSize; ++NumberIndex)
+                NumberOverflow |= __builtin_mul_overflow(doDivisionRoundNative(NumberList[NumberIndex].NumberValue, NumberUnit), NumberUnit, &NumberListResult[NumberIndex].NumberValue);
+            if (NumberOverflow) throw Exception(String(u"Decimal<NumberScale>::doRoundBatch(const Decimal*, Decimal*, intmax_t, unsigned short) NumberList"));
         }
 
-        Integer getAbsolute() const noexcept {
-            Integer NumberResult(*this);
-            NumberResult.NumberSignature = true;
+        constexpr Decimal doSubtraction(const Decimal &NumberOther) const {
+            Decimal NumberResult;
+            if (__builtin_sub_overflow(NumberValue, NumberOther.NumberValue, &NumberResult.NumberValue)) throw Exception(String(u"Decimal<NumberScale>::doSubtraction(const Decimal&) NumberOther"));
             return NumberResult;
         }
 
-        Integer getOpposite() const noexcept {
-            Integer NumberResult(*this);
-            NumberResult.NumberSignature = !NumberSignature;
-            return NumberResult;
+        constexpr Decimal &doSubtractionAssign(const Decimal &NumberOther) {
+            return *this = doSubtraction(NumberOther);
         }
 
-        intmax_t getValue() const {
-            if ((NumberSignature && doCompare(std::numeric_limits<intmax_t>::max()) > 0) ||
-                (!NumberSignature && doCompare(std::numeric_limits<intmax_t>::min()) < 0))
-                throw Exception(String(u"Integer::getValue() Number value out of limits"));
-            intmax_t NumberValue = NumberList.back();
-            if (NumberList.size() == 1) return NumberSignature ? NumberValue : -NumberValue;
-            for (auto NumberPart = (intmax_t) NumberList.size() - 2; NumberPart >= 0; --NumberPart)
-                NumberValue = NumberValue * NumberBaseUnit + NumberList[NumberPart];
-            return NumberSignature ? NumberValue : -NumberValue;
+        constexpr Decimal getAbsolute() const {
+            return NumberValue < 0 ? getOpposite() : *this;
         }
 
-        bool isEven() const noexcept {
-            return !(NumberList[0] % 10 & 1);
+        constexpr Decimal getOpposite() const {
+            return Decimal().doSubtraction(*this);
         }
 
-        bool isNegative() const noexcept {
-            return doCompare(0) && !NumberSignature;
+        constexpr intmax_t getUnscaledValue() const noexcept {
+            return NumberValue;
         }
 
-        bool isOdd() const noexcept {
-            return NumberList[0] % 10 & 1;
+        template<std::floating_point T = double>
+        constexpr T getValue() const noexcept {
+            return (T) NumberValue / (T) NumberFactor;
         }
 
-        bool isPositive() const noexcept {
-            return doCompare(0) && NumberSignature;
+        constexpr bool isNegative() const noexcept {
+            return NumberValue < 0;
         }
 
-        String toString() const noexcept override {
-            return toString(10);
+        constexpr bool isPositive() const noexcept {
+            return NumberValue > 0;
         }
 
-        String toString(unsigned short NumberRadix) const {
-            if (NumberRadix < 2 || NumberRadix > 36) throw Exception(String(u"Integer::toString(unsigned short) NumberRadix"));
-            StringStream CharacterStream;
-            if (!NumberSignature) CharacterStream.addCharacter(u'-');
-            static std::map<unsigned short, char16_t> NumberDigitMapping;
-            if (NumberDigitMapping.empty()) {
-                for (unsigned short NumberDigit = 0; NumberDigit < 10; ++NumberDigit)
-                    NumberDigitMapping[NumberDigit] = char16_t(NumberDigit + 48);
-                for (unsigned short NumberDigit = 0; NumberDigit < 26; ++NumberDigit)
-                    NumberDigitMapping[NumberDigit + 10] = char16_t(NumberDigit + 65);
-            }
-            Integer NumberCurrent(getAbsolute()), NumberRadixInteger(NumberRadix);
-            while (NumberCurrent.NumberList[0]) {
-                CharacterStream.addCharacter(NumberDigitMapping[NumberCurrent.doModulo(NumberRadixInteger).NumberList[0]]);
-                NumberCurrent.NumberList = NumberCurrent.doDivision(NumberRadixInteger).NumberList;
-            }
-            return CharacterStream.toString().doReverse();
+        Fraction toFraction() const noexcept {
+            return {Integer(NumberValue), Integer(NumberFactor)};
+        }
+
+        Integer toInteger() const noexcept {
+            return NumberValue / NumberFactor;
+        }
+
+        String toString() const noexcept {
+            std::u16string NumberString(Integer(NumberValue).getAbsolute().toString().toU16String());
+            if (NumberScale) {
+                if (NumberString.size() <= NumberScale) NumberString.insert(0, NumberScale + 1 - NumberString.size(), u'0');
+                NumberString.insert(NumberString.size() - NumberScale, 1, u'.');
+            }
+            if (NumberValue < 0) NumberString.insert(0, 1, u'-');
+            return NumberString;
         }
     };
 
-    class Fraction final : public Object {
+    template<size_t NumberBitCount, bool NumberSigned = false>
+    class FixedInteger final {
     private:
-        bool NumberSignature;
-        Integer NumberDenominator, NumberNumerator;
+        static_assert(NumberBitCount && !(NumberBitCount & 63));
+
+        template<size_t, bool> friend class FixedInteger;
+
+        static constexpr size_t NumberSize = NumberBitCount >> 6;
+
+        uint64_t NumberList[NumberSize];
+
+        static constexpr intmax_t doCompareKernel(const uint64_t *NumberSource1, const uint64_t *NumberSource2) noexcept {
+            for (size_t NumberPart = NumberSize; NumberPart-- > 0;)
+                if (NumberSource1[NumberPart] != NumberSource2[NumberPart])
+                    return NumberSource1[NumberPart] > NumberSource2[NumberPart] ? 1 : -1;
+            return 0;
+        }
+
+        static constexpr void doDivisionCore(const FixedInteger &NumberDividend, const FixedInteger &NumberDivisor, FixedInteger *NumberQuotient, FixedInteger *NumberRemainder) {
+            if (NumberDivisor.isZero()) throw Exception(String(u"FixedInteger::doDivisionCore(const FixedInteger&, const FixedInteger&, FixedInteger*, FixedInteger*) NumberDivisor"));
+            bool NumberNegativeDividend = NumberDividend.isNegative(), NumberNegativeDivisor = NumberDivisor.isNegative();
+            FixedInteger NumberDividendMagnitude(NumberDividend.getAbsolute()), NumberDivisorMagnitude(NumberDivisor.getAbsolute()), NumberQuotientResult, NumberRemainderResult;
+            doDivisionKernel(NumberQuotientResult.NumberList, NumberRemainderResult.NumberList, NumberDividendMagnitude.NumberList, NumberSize, NumberDivisorMagnitude.NumberList);
+            if (NumberNegativeDividend != NumberNegativeDivisor) NumberQuotientResult.doNegate();
+            if (NumberNegativeDividend) NumberRemainderResult.doNegate();
+            if (NumberQuotient) *NumberQuotient = NumberQuotientResult;
+            if (NumberRemainder) *NumberRemainder = NumberRemainderResult;
+        }
+
+        static constexpr void doDivisionKernel(uint64_t *NumberQuotient, uint64_t *NumberRemainder, const uint64_t *NumberDividend, size_t NumberSizeDividend, const uint64_t *NumberDivisor) noexcept {
+            if (NumberQuotient) std::fill(NumberQuotient, NumberQuotient + NumberSizeDividend, 0);
+            std::fill(NumberRemainder, NumberRemainder + NumberSize, 0);
+            size_t NumberSizeDivisor = getSize(NumberDivisor, NumberSize);
+            NumberSizeDividend = getSize(NumberDividend, NumberSizeDividend);
+            if (NumberSizeDividend < NumberSizeDivisor) {
+                std::copy(NumberDividend, NumberDividend + NumberSizeDividend, NumberRemainder);
+                return;
+            }
+            if (NumberSize == 1 || NumberSizeDivisor == 1) {
+                uint64_t NumberQuotientList[NumberSize << 1]{};
+                NumberRemainder[0] = Integer::doDivisionLimbKernel(NumberQuotient ? NumberQuotient : NumberQuotientList, NumberDividend, NumberSizeDividend, NumberDivisor[0]);
+                return;
+            }
+            auto NumberShift = (unsigned short) std::countl_zero(NumberDivisor[NumberSizeDivisor - 1]);
+            uint64_t NumberNormal[NumberSize]{}, NumberWindow[(NumberSize << 1) + 1]{};
+            for (size_t NumberPart = 0; NumberPart < NumberSizeDivisor; ++NumberPart)
+                NumberNormal[NumberPart] = NumberDivisor[NumberPart] << NumberShift | (NumberShift && NumberPart ? NumberDivisor[NumberPart - 1] >> (64 - NumberShift) : 0);
+            for (size_t NumberPart = 0; NumberPart < NumberSizeDividend; ++NumberPart)
+                NumberWindow[NumberPart] = NumberDividend[NumberPart] << NumberShift | (NumberShift && NumberPart ? NumberDividend[NumberPart - 1] >> (64 - NumberShift) : 0);
+            NumberWindow[NumberSizeDividend] = NumberShift ? NumberDividend[NumberSizeDividend - 1] >> (64 - NumberShift) : 0;
+            uint64_t NumberDivisorHigh = NumberNormal[NumberSizeDivisor - 1], NumberDivisorLow = NumberNormal[NumberSizeDivisor - 2], NumberReciprocal = Integer::getReciprocalLimb(NumberDivisorHigh);
+            for (size_t NumberPart = NumberSizeDividend - NumberSizeDivisor + 1; NumberPart-- > 0;) {
+                uint64_t *NumberTarget = NumberWindow + NumberPart, NumberEstimate = 0, NumberEstimateRemainder = 0;
+                bool NumberOverflow = false;
+                if (NumberTarget[NumberSizeDivisor] >= NumberDivisorHigh) {
+                    NumberEstimate = std::numeric_limits<uint64_t>::max();
+                    NumberEstimateRemainder = NumberTarget[NumberSizeDivisor - 1] + NumberDivisorHigh;
+                    NumberOverflow = NumberEstimateRemainder < NumberDivisorHigh;
+                } else NumberEstimate = Integer::doDivisionReciprocal(NumberTarget[NumberSizeDivisor], NumberTarget[NumberSizeDivisor - 1], NumberDivisorHigh, NumberReciprocal, NumberEstimateRemainder);
+                while (!NumberOverflow && (unsigned __int128) NumberEstimate * NumberDivisorLow > ((unsigned __int128) NumberEstimateRemainder << 64 | NumberTarget[NumberSizeDivisor - 2])) {
+                    --NumberEstimate;
+                    NumberEstimateRemainder += NumberDivisorHigh;
+                    NumberOverflow = NumberEstimateRemainder < NumberDivisorHigh;
+                }
+                uint64_t NumberBorrow = 0, NumberCarry = 0;
+                for (size_t NumberPosition = 0; NumberPosition < NumberSizeDivisor; ++NumberPosition) {
+                    unsigned __int128 NumberProduct = (unsigned __int128) NumberEstimate * NumberNormal[NumberPosition] + NumberCarry;
+                    NumberCarry = (uint64_t) (NumberProduct >> 64);
+                    unsigned __int128 NumberDifference = (unsigned __int128) NumberTarget[NumberPosition] - (uint64_t) NumberProduct - NumberBorrow;
+                    NumberTarget[NumberPosition] = (uint64_t) NumberDifference;
+                    NumberBorrow = (uint64_t) (NumberDifference >> 64) & 1;
+                }
+                unsigned __int128 NumberDifference = (unsigned __int128) NumberTarget[NumberSizeDivisor] - NumberCarry - NumberBorrow;
+                NumberTarget[NumberSizeDivisor] = (uint64_t) NumberDifference;
+                if ((uint64_t) (NumberDifference >> 64) & 1) {
+                    --NumberEstimate;
+                    NumberCarry = 0;
+                    for (size_t NumberPosition = 0; NumberPosition < NumberSizeDivisor; ++NumberPosition) {
+                        unsigned __int128 NumberSummation = (unsigned __int128) NumberTarget[NumberPosition] + NumberNormal[NumberPosition] + NumberCarry;
+                        NumberTarget[NumberPosition] = (uint64_t) NumberSummation;
+                        NumberCarry = (uint64_t) (NumberSummation >> 64);
+                    }
+                    NumberTarget[NumberSizeDivisor] += NumberCarry;
+                }
+                if (NumberQuotient) NumberQuotient[NumberPart] = NumberEstimate;
+            }
+            for (size_t NumberPart = 0; NumberPart < NumberSizeDivisor; ++NumberPart)
+                NumberRemainder[NumberPart] = NumberWindow[NumberPart] >> NumberShift | (NumberShift ? NumberWindow[NumberPart + 1] << (64 - NumberShift) : 0);
+        }
 
-        Integer getGreatestCommonFactor(const Integer &Number1, const Integer &Number2) const noexcept {
-            if (Number2.getAbsolute().doCompare(Integer(0)) == 0) {
-                return Number1;
+        static constexpr void doMultiplicationKernel(uint64_t *NumberTarget, const uint64_t *NumberSource1, const uint64_t *NumberSource2, size_t NumberSizeTarget) noexcept {
+            std::fill(NumberTarget, NumberTarget + NumberSizeTarget, 0);
+            for (size_t NumberPart1 = 0; NumberPart1 < NumberSize; ++NumberPart1) {
+                if (!NumberSource1[NumberPart1]) continue;
+                uint64_t NumberCarry = 0;
+                for (size_t NumberPart2 = 0; NumberPart2 < NumberSize && NumberPart1 + NumberPart2 < NumberSizeTarget; ++NumberPart2) {
+                    unsigned __int128 NumberCurrent = (unsigned __int128) NumberSource1[NumberPart1] * NumberSource2[NumberPart2] + NumberTarget[NumberPart1 + NumberPart2] + NumberCarry;
+                    NumberTarget[NumberPart1 + NumberPart2] = (uint64_t) NumberCurrent;
+                    NumberCarry = (uint64_t) (NumberCurrent >> 64);
+                }
+                if (NumberPart1 + NumberSize < NumberSizeTarget) NumberTarget[NumberPart1 + NumberSize] = NumberCarry;
+            }
+        }
+
+        constexpr void doNegate() noexcept {
+            uint64_t NumberCarry = 1;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                NumberList[NumberPart] = ~NumberList[NumberPart] + NumberCarry;
+                NumberCarry = NumberCarry && !NumberList[NumberPart];
             }
-            return getGreatestCommonFactor(Number2, Number1.doModulo(Number2));
+        }
+
+        static constexpr size_t getSize(const uint64_t *NumberSource, size_t NumberSizeSource) noexcept {
+            while (NumberSizeSource && !NumberSource[NumberSizeSource - 1]) --NumberSizeSource;
+            return NumberSizeSource;
+        }
+
+        constexpr bool isZero() const noexcept {
+            return !getSize(NumberList, NumberSize);
         }
     public:
-        Fraction(const Integer &NumberValueSource) noexcept : NumberSignature(NumberValueSource.isPositive()), NumberDenominator(1), NumberNumerator(NumberValueSource) {}
+        constexpr FixedInteger() noexcept : NumberList{} {}
 
-        Fraction(const Integer &NumberNumeratorSource, const Integer &NumberDenominatorSource) noexcept {
-            NumberSignature = !(NumberDenominatorSource.isPositive() ^ NumberNumeratorSource.isPositive());
-            Integer NumberFactor = getGreatestCommonFactor(NumberDenominatorSource, NumberNumeratorSource);
-            NumberDenominator = NumberDenominatorSource.getAbsolute().doDivision(NumberFactor);
-            NumberNumerator = NumberNumeratorSource.getAbsolute().doDivision(NumberFactor);
+        template<std::integral T>
+        constexpr FixedInteger(T NumberValue) noexcept : NumberList{} {
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                NumberList[NumberPart] = (uint64_t) NumberValue;
+                if constexpr (sizeof(T) > sizeof(uint64_t)) NumberValue >>= 64;
+                else NumberValue = (T) (std::is_signed_v<T> && NumberValue < 0 ? -1 : 0);
+            }
         }
 
-        Fraction doAddition(const Fraction &NumberOther) const noexcept {
-            if (NumberSignature && !NumberOther.NumberSignature) return doSubtraction(NumberOther.getAbsolute());
-            if (!NumberSignature && NumberOther.NumberSignature) return NumberOther.doSubtraction(getAbsolute());
-            if (!NumberSignature && !NumberOther.NumberSignature) return getAbsolute().doAddition(NumberOther.getAbsolute()).getOpposite();
-            return Fraction(NumberNumerator.doMultiplication(NumberOther.NumberDenominator).doAddition(NumberDenominator.doMultiplication(NumberOther.NumberNumerator)), NumberDenominator.doMultiplication(NumberOther.NumberDenominator));
+        template<size_t NumberBitCountSource, bool NumberSignedSource>
+        constexpr explicit FixedInteger(const FixedInteger<NumberBitCountSource, NumberSignedSource> &NumberSource) noexcept : NumberList{} {
+            uint64_t NumberExtension = NumberSource.isNegative() ? ~(uint64_t) 0 : 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart)
+                NumberList[NumberPart] = NumberPart < FixedInteger<NumberBitCountSource, NumberSignedSource>::NumberSize ? NumberSource.NumberList[NumberPart] : NumberExtension;
         }
 
-        intmax_t doCompare(const Fraction &NumberOther) const noexcept {
-            if (NumberSignature != NumberOther.NumberSignature && NumberNumerator.doCompare(Integer(0)) && NumberDenominator.doCompare(Integer(0))) return (intmax_t) NumberSignature - NumberOther.NumberSignature;
-            return NumberNumerator.doMultiplication(NumberOther.NumberDenominator).doCompare(NumberDenominator.doMultiplication(NumberOther.NumberNumerator));
+        explicit FixedInteger(const Integer &NumberSource) noexcept : NumberList{} {
+            std::copy(NumberSource.NumberList.begin(), NumberSource.NumberList.begin() + std::min(NumberSource.NumberList.size(), NumberSize), NumberList);
+            if (NumberSource.isNegative()) doNegate();
+        }
+
+        explicit FixedInteger(const String &NumberValue, unsigned short NumberRadix = 10) : FixedInteger(Integer(NumberValue, NumberRadix)) {}
+
+        constexpr FixedInteger doAddition(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doAdditionAssign(NumberOther);
+        }
+
+        constexpr FixedInteger &doAdditionAssign(const FixedInteger &NumberOther) noexcept {
+            uint64_t NumberCarry = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberList[NumberPart] + NumberOther.NumberList[NumberPart] + NumberCarry;
+                NumberList[NumberPart] = (uint64_t) NumberCurrent;
+                NumberCarry = (uint64_t) (NumberCurrent >> 64);
+            }
+            return *this;
+        }
+
+        constexpr FixedInteger doBitwiseAnd(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doBitwiseAndAssign(NumberOther);
+        }
+
+        constexpr FixedInteger &doBitwiseAndAssign(const FixedInteger &NumberOther) noexcept {
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) NumberList[NumberPart] &= NumberOther.NumberList[NumberPart];
+            return *this;
+        }
+
+        constexpr FixedInteger doBitwiseOr(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doBitwiseOrAssign(NumberOther);
+        }
+
+        constexpr FixedInteger &doBitwiseOrAssign(const FixedInteger &NumberOther) noexcept {
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) NumberList[NumberPart] |= NumberOther.NumberList[NumberPart];
+            return *this;
+        }
+
+        constexpr FixedInteger doBitwiseXor(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doBitwiseXorAssign(NumberOther);
+        }
+
+        constexpr FixedInteger &doBitwiseXorAssign(const FixedInteger &NumberOther) noexcept {
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) NumberList[NumberPart] ^= NumberOther.NumberList[NumberPart];
+            return *this;
+        }
+
+        constexpr intmax_t doCompare(const FixedInteger &NumberOther) const noexcept {
+            if (isNegative() != NumberOther.isNegative()) return isNegative() ? -1 : 1;
+            return doCompareKernel(NumberList, NumberOther.NumberList);
+        }
+
+        constexpr FixedInteger doDivision(const FixedInteger &NumberOther) const {
+            FixedInteger NumberQuotient;
+            doDivisionCore(*this, NumberOther, &NumberQuotient, nullptr);
+            return NumberQuotient;
+        }
+
+        constexpr FixedInteger &doDivisionAssign(const FixedInteger &NumberOther) {
+            doDivisionCore(*this, NumberOther, this, nullptr);
+            return *this;
+        }
+
+        constexpr std::pair<FixedInteger, FixedInteger> doDivisionModulo(const FixedInteger &NumberOther) const {
+            FixedInteger NumberQuotient, NumberRemainder;
+            doDivisionCore(*this, NumberOther, &NumberQuotient, &NumberRemainder);
+            return {NumberQuotient, NumberRemainder};
+        }
+
+        constexpr FixedInteger doModulo(const FixedInteger &NumberOther) const {
+            FixedInteger NumberRemainder;
+            doDivisionCore(*this, NumberOther, nullptr, &NumberRemainder);
+            return NumberRemainder;
         }
 
-        Fraction doDivision(const Fraction &NumberOther) const noexcept {
-            Fraction NumberResult(NumberNumerator.doMultiplication(NumberOther.NumberDenominator), NumberDenominator.doMultiplication(NumberOther.NumberNumerator));
-            NumberResult.NumberSignature = !(NumberSignature ^ NumberOther.NumberSignature);
+        constexpr FixedInteger &doModuloAssign(const FixedInteger &NumberOther) {
+            doDivisionCore(*this, NumberOther, nullptr, this);
+            return *this;
+        }
+
+        constexpr FixedInteger doMultiplication(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult;
+            doMultiplicationKernel(NumberResult.NumberList, NumberList, NumberOther.NumberList, NumberSize);
             return NumberResult;
         }
 
-        Fraction doMultiplication(const Fraction &NumberOther) const noexcept {
-            Fraction NumberResult(NumberNumerator.doMultiplication(NumberOther.NumberNumerator), NumberDenominator.doMultiplication(NumberOther.NumberDenominator));
-            NumberResult.NumberSignature = !(NumberSignature ^ NumberOther.NumberSignature);
+        constexpr FixedInteger &doMultiplicationAssign(const FixedInteger &NumberOther) noexcept {
+            return *this = doMultiplication(NumberOther);
+        }
+
+        constexpr FixedInteger doMultiplicationModulo(const FixedInteger &NumberMultiplier, const FixedInteger &NumberModulo) const {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doMultiplicationModuloAssign(NumberMultiplier, NumberModulo);
+        }
+
+        constexpr FixedInteger &doMultiplicationModuloAssign(const FixedInteger &NumberMultiplier, const FixedInteger &NumberModulo) {
+            if (NumberModulo.isZero()) throw Exception(String(u"FixedInteger::doMultiplicationModuloAssign(const FixedInteger&, const FixedInteger&) NumberModulo"));
+            bool NumberNegative = isNegative() != NumberMultiplier.isNegative();
+            FixedInteger NumberMagnitude1(getAbsolute()), NumberMagnitude2(NumberMultiplier.getAbsolute()), NumberModuloMagnitude(NumberModulo.getAbsolute());
+            uint64_t NumberProduct[NumberSize << 1]{};
+            doMultiplicationKernel(NumberProduct, NumberMagnitude1.NumberList, NumberMagnitude2.NumberList, NumberSize << 1);
+            doDivisionKernel(nullptr, NumberList, NumberProduct, NumberSize << 1, NumberModuloMagnitude.NumberList);
+            if (NumberNegative) doNegate();
+            return *this;
+        }
+
+        constexpr FixedInteger doPower(const FixedInteger &NumberExponent) const {
+            if (NumberExponent.isNegative()) throw Exception(String(u"FixedInteger::doPower(const FixedInteger&) NumberExponent"));
+            FixedInteger NumberBase(*this), NumberResult(1);
+            for (size_t NumberBit = 0, NumberBitCountExponent = NumberExponent.getBitLength(); NumberBit < NumberBitCountExponent; ++NumberBit) {
+                if (NumberExponent.isBitSet(NumberBit)) NumberResult.doMultiplicationAssign(NumberBase);
+                if (NumberBit + 1 < NumberBitCountExponent) NumberBase.doMultiplicationAssign(NumberBase);
+            }
             return NumberResult;
         }
 
-        Fraction doSubtraction(const Fraction &NumberOther) const noexcept {
-            if (NumberSignature && !NumberOther.NumberSignature) return doAddition(NumberOther.getAbsolute());
-            if (doCompare(NumberOther) < 0) return NumberOther.doSubtraction(*this).getOpposite();
-            return Fraction(NumberNumerator.doMultiplication(NumberOther.NumberDenominator).doSubtraction(NumberDenominator.doMultiplication(NumberOther.NumberNumerator)), NumberDenominator.doMultiplication(NumberOther.NumberDenominator));
+        constexpr FixedInteger doPower(const FixedInteger &NumberExponent, const FixedInteger &NumberModulo) const {
+            if (NumberExponent.isNegative()) throw Exception(String(u"FixedInteger::doPower(const FixedInteger&, const FixedInteger&) NumberExponent"));
+            FixedInteger NumberBase(doModulo(NumberModulo)), NumberResult(FixedInteger(1).doModulo(NumberModulo));
+            for (size_t NumberBit = 0, NumberBitCountExponent = NumberExponent.getBitLength(); NumberBit < NumberBitCountExponent; ++NumberBit) {
+                if (NumberExponent.isBitSet(NumberBit)) NumberResult.doMultiplicationModuloAssign(NumberBase, NumberModulo);
+                if (NumberBit + 1 < NumberBitCountExponent) NumberBase.doMultiplicationModuloAssign(NumberBase, NumberModulo);
+            }
+            return NumberResult;
         }
 
-        Fraction getAbsolute() const noexcept {
-            return Fraction(NumberNumerator, NumberDenominator);
+        constexpr FixedInteger doShiftLeft(uintmax_t NumberShift) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doShiftLeftAssign(NumberShift);
         }
 
-        Integer getDenominator() const noexcept {
-            return NumberDenominator;
+        constexpr FixedInteger &doShiftLeftAssign(uintmax_t NumberShift) noexcept {
+            if (NumberShift >= NumberBitCount) {
+                std::fill(NumberList, NumberList + NumberSize, 0);
+                return *this;
+            }
+            size_t NumberLimb = NumberShift >> 6;
+            auto NumberBit = (unsigned short) (NumberShift & 63);
+            for (size_t NumberPart = NumberSize; NumberPart-- > NumberLimb;)
+                NumberList[NumberPart] = NumberList[NumberPart - NumberLimb] << NumberBit | (NumberBit && NumberPart > NumberLimb ? NumberList[NumberPart - NumberLimb - 1] >> (64 - NumberBit) : 0);
+            std::fill(NumberList, NumberList + NumberLimb, 0);
+            return *this;
         }
 
-        Integer getNumerator() const noexcept {
-            return NumberNumerator;
+        constexpr FixedInteger doShiftRight(uintmax_t NumberShift) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doShiftRightAssign(NumberShift);
         }
 
-        Fraction getOpposite() const noexcept {
-            Fraction NumberResult(NumberNumerator, NumberDenominator);
-            NumberResult.NumberSignature = !NumberSignature;
+        constexpr FixedInteger &doShiftRightAssign(uintmax_t NumberShift) noexcept {
+            bool NumberNegative = isNegative();
+            if (NumberNegative) doNegate();
+            if (NumberShift >= NumberBitCount) std::fill(NumberList, NumberList + NumberSize, 0);
+            else {
+                size_t NumberLimb = NumberShift >> 6;
+                auto NumberBit = (unsigned short) (NumberShift & 63);
+                for (size_t NumberPart = 0; NumberPart + NumberLimb < NumberSize; ++NumberPart)
+                    NumberList[NumberPart] = NumberList[NumberPart + NumberLimb] >> NumberBit | (NumberBit && NumberPart + NumberLimb + 1 < NumberSize ? NumberList[NumberPart + NumberLimb + 1] << (64 - NumberBit) : 0);
+                std::fill(NumberList + NumberSize - NumberLimb, NumberList + NumberSize, 0);
+            }
+            if (NumberNegative) doNegate();
+            return *this;
+        }
+
+        constexpr FixedInteger doSubtraction(const FixedInteger &NumberOther) const noexcept {
+            FixedInteger NumberResult(*this);
+            return NumberResult.doSubtractionAssign(NumberOther);
+        }
+
+        constexpr FixedInteger &doSubtractionAssign(const FixedInteger &NumberOther) noexcept {
+            uint64_t NumberBorrow = 0;
+            for (size_t NumberPart = 0; NumberPart < NumberSize; ++NumberPart) {
+                unsigned __int128 NumberCurrent = (unsigned __int128) NumberList[NumberPart] - NumberOther.NumberList[NumberPart] - NumberBorrow;
+                NumberList[NumberPart] = (uint64_t) NumberCurrent;
+                NumberBorrow = (uint64_t) (NumberCurrent >> 64) & 1;
+            }
+            return *this;
+        }
+
+        constexpr FixedInteger getAbsolute() const noexcept {
+            FixedInteger NumberResult(*this);
+            if (isNegative()) NumberResult.doNegate();
             return NumberResult;
         }
 
-        [[deprecated]] double getValue() const {
-            return (double) NumberNumerator.getValue() / NumberDenominator.getValue() * (NumberSignature ? 1.0 : -1.0);
+        constexpr size_t getBitLength() const noexcept {
+            FixedInteger NumberMagnitude(getAbsolute());
+            size_t NumberSizeMagnitude = getSize(NumberMagnitude.NumberList, NumberSize);
+            return NumberSizeMagnitude ? (NumberSizeMagnitude << 6) - std::countl_zero(NumberMagnitude.NumberList[NumberSizeMagnitude - 1]) : 0;
         }
 
-        bool isNegative() const noexcept {
-            return !NumberSignature;
+        constexpr FixedInteger getOpposite() const noexcept {
+            FixedInteger NumberResult(*this);
+            NumberResult.doNegate();
+            return NumberResult;
         }
 
-        bool isPositive() const noexcept {
-            return NumberSignature;
+        constexpr FixedInteger getSquareRoot() const {
+            if (isNegative()) throw Exception(String(u"FixedInteger::getSquareRoot() NumberSignature"));
+            if (isZero()) return {};
+            FixedInteger NumberResult(FixedInteger(1).doShiftLeftAssign((getBitLength() + 1) >> 1)), NumberNext;
+            for (;;) {
+                NumberNext = doDivision(NumberResult).doAdditionAssign(NumberResult).doShiftRightAssign(1);
+                if (NumberNext.doCompare(NumberResult) >= 0) return NumberResult;
+                NumberResult = NumberNext;
+            }
         }
 
-        String toString() const noexcept override {
-            std::basic_stringstream<char16_t> StringStream;
-            if (!NumberSignature) StringStream << u'-';
-            StringStream << NumberNumerator.toString().toU16String() << u'/' << NumberDenominator.toString().toU16String();
-            return StringStream.str();
+        constexpr size_t getTrailingZeroCount() const noexcept {
+            size_t NumberPart = 0;
+            while (NumberPart < NumberSize && !NumberList[NumberPart]) ++NumberPart;
+            return NumberPart == NumberSize ? 0 : (NumberPart << 6) + std::countr_zero(NumberList[NumberPart]);
+        }
+
+        constexpr intmax_t getValue() const {
+            uint64_t NumberExtension = NumberSigned && NumberList[0] >> 63 ? ~(uint64_t) 0 : 0;
+            bool NumberOverflow = !NumberSigned && NumberList[0] >> 63;
+            for (size_t NumberPart = 1; NumberPart < NumberSize; ++NumberPart) NumberOverflow |= NumberList[NumberPart] != NumberExtension;
+            if (NumberOverflow) throw Exception(String(u"FixedInteger::getValue() Number value out of limits"));
+            return (intmax_t) NumberList[0];
+        }
+
+        constexpr bool isBitSet(size_t NumberBit) const noexcept {
+            return NumberBit < NumberBitCount && (NumberList[NumberBit >> 6] >> (NumberBit & 63) & 1);
+        }
+
+        constexpr bool isEven() const noexcept {
+            return !(NumberList[0] & 1);
+        }
+
+        constexpr bool isNegative() const noexcept {
+            return NumberSigned && NumberList[NumberSize - 1] >> 63;
+        }
+
+        constexpr bool isOdd() const noexcept {
+            return NumberList[0] & 1;
+        }
+
+        constexpr bool isPerfectSquare() const noexcept {
+            if (isNegative()) return false;
+            if (!(0x0202021202030213 >> (NumberList[0] & 63) & 1)) return false;
+            FixedInteger NumberRoot(getSquareRoot());
+            return !NumberRoot.doMultiplication(NumberRoot).doCompare(*this);
+        }
+
+        constexpr bool isPositive() const noexcept {
+            return !isNegative() && !isZero();
+        }
+
+        Integer toInteger() const noexcept {
+            Integer NumberResult(getAbsolute().NumberList, NumberSize);
+            return isNegative() ? std::move(NumberResult).getOpposite() : NumberResult;
+        }
+
+        String toString() const noexcept {
+            return toInteger().toString();
+        }
+
+        String toString(unsigned short NumberRadix) const {
+            return toInteger().toString(NumberRadix);
         }
     };
 }
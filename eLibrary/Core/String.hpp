@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <codecvt>
+#include <concepts>
 #include <cstring>
 #include <locale>
 #include <map>
@@ -203,7 +204,7 @@ namespace eLibrary {
             return {CharacterContainer, CharacterContainer + CharacterSize + 1};
         }
 
-        template<std::derived_from<Object> T>
+        template<typename T> requires requires(const T &ObjectSource) {{ObjectSource.toString()} -> std::convertible_to<String>;}
         static String valueOf(const T &ObjectSource) noexcept {
             return ObjectSource.toString();
         }
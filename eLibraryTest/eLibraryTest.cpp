@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <ctime>
+#include <numeric>
 #include <random>
+#include <thread>
 
 #include <eLibrary>
 using namespace eLibrary;
@@ -16,7 +18,277 @@ ankerl::nanobench::Bench TestBench;
 std::mt19937 RandomEngine;
 std::random_device RandomDevice;
 
+Integer getRandomInteger(unsigned NumberDigitCount) {
+    std::string NumberString;
+    for (unsigned NumberDigit = 0; NumberDigit < NumberDigitCount; ++NumberDigit)
+        NumberString.push_back("0123456789ABCDEF"[RandomEngine() & 15]);
+    return {String(NumberString), 16};
+}
+
+TEST_SUITE("BigFloat") {
+    TEST_CASE("BigFloatArithmetic") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            size_t NumberPrecision = RandomEngine() % 300 + 1;
+            Integer NumberMantissa1(getRandomInteger(RandomEngine() % 100 + 1)), NumberMantissa2(getRandomInteger(RandomEngine() % 100 + 1));
+            if (RandomEngine() & 1) NumberMantissa1 = NumberMantissa1.getOpposite();
+            if (RandomEngine() & 1) NumberMantissa2 = NumberMantissa2.getOpposite();
+            BigFloat NumberObject1(NumberMantissa1, (intmax_t) (RandomEngine() % 400) - 200, NumberPrecision), NumberObject2(NumberMantissa2, (intmax_t) (RandomEngine() % 400) - 200, NumberPrecision);
+            Fraction NumberFraction1(NumberObject1.toFraction()), NumberFraction2(NumberObject2.toFraction());
+            CHECK(NumberObject1.doAddition(NumberObject2).doCompare(BigFloat(NumberFraction1.doAddition(NumberFraction2), NumberPrecision)) == 0);
+            CHECK(NumberObject1.doSubtraction(NumberObject2).doCompare(BigFloat(NumberFraction1.doSubtraction(NumberFraction2), NumberPrecision)) == 0);
+            CHECK(NumberObject1.doMultiplication(NumberObject2).doCompare(BigFloat(NumberFraction1.doMultiplication(NumberFraction2), NumberPrecision)) == 0);
+            if (!NumberObject2.isZero()) CHECK(NumberObject1.doDivision(NumberObject2).doCompare(BigFloat(NumberFraction1.doDivision(NumberFraction2), NumberPrecision)) == 0);
+            CHECK(NumberObject1.doCompare(NumberObject2) == NumberFraction1.doCompare(NumberFraction2));
+            CHECK(NumberObject1.getAbsolute().doMultiplication(NumberObject1.getAbsolute()).getSquareRoot().doCompare(NumberObject1.getAbsolute()) == 0);
+        }
+        for (size_t NumberPrecision : {24, 53, 128, 1000}) {
+            BigFloat NumberLimit(1, 8 - (intmax_t) NumberPrecision);
+            for (unsigned NumberEpoch = 0; NumberEpoch < 20; ++NumberEpoch) {
+                BigFloat NumberSource(getRandomInteger(RandomEngine() % 16 + 1).doAddition(1), -(intmax_t) (RandomEngine() % 64), NumberPrecision);
+                BigFloat NumberCosine(Mathematics::doCosineBigFloat(NumberSource)), NumberSine(Mathematics::doSineBigFloat(NumberSource));
+                CHECK(NumberCosine.doMultiplication(NumberCosine).doAddition(NumberSine.doMultiplication(NumberSine)).doSubtraction(BigFloat(1)).getAbsolute().doCompare(NumberLimit) <= 0);
+                CHECK(Mathematics::doExponentBigFloat(Mathematics::doLogarithmEBigFloat(NumberSource)).doDivision(NumberSource).doSubtraction(BigFloat(1)).getAbsolute().doCompare(NumberLimit) <= 0);
+                CHECK(Mathematics::doPowerBigFloat(NumberSource, BigFloat(1, -1, NumberPrecision)).doDivision(NumberSource.getSquareRoot()).doSubtraction(BigFloat(1)).getAbsolute().doCompare(NumberLimit) <= 0);
+                CHECK(Mathematics::doPowerBigFloat(NumberSource, BigFloat(3, 0, NumberPrecision)).doCompare(BigFloat(NumberSource.toFraction().doMultiplication(NumberSource.toFraction()).doMultiplication(NumberSource.toFraction()), NumberPrecision)) == 0);
+            }
+        }
+        CHECK(Mathematics::doExponentBigFloat(BigFloat(1, 0, 200)).toString().doCompare(String(u"2.718281828459045235360287471352662497757247093699959574966968")) == 0);
+        CHECK(Mathematics::doLogarithmEBigFloat(BigFloat(2, 0, 200)).toString().doCompare(String(u"6.9314718055994530941723212145817656807550013436025525412068e-1")) == 0);
+        CHECK(Mathematics::doSineBigFloat(BigFloat(355, 0, 200)).toString().doCompare(String(u"-3.014435335948844921433028000865009959025580706632464910578985e-5")) == 0);
+        CHECK(BigFloat(2, 0, 200).getSquareRoot().toString().doCompare(String(u"1.41421356237309504880168872420969807856967187537694807317668")) == 0);
+        CHECK(BigFloat(Fraction(Integer(-1), Integer(3)), 53).getValue() == -1.0 / 3);
+        CHECK(BigFloat(Fraction(Integer(7), Integer(2))).toInteger().doCompare(3) == 0);
+        CHECK_THROWS(BigFloat(1).doDivision(BigFloat()));
+        CHECK_THROWS(BigFloat(-1).getSquareRoot());
+        CHECK_THROWS(BigFloat(1, 0, 0));
+        CHECK_THROWS(Mathematics::doLogarithmEBigFloat(BigFloat()));
+        CHECK_THROWS(Mathematics::doPowerBigFloat(BigFloat(-2), BigFloat(1, -1)));
+
+        BigFloat NumberObject1(Fraction(Integer(7), Integer(3)), 3322), NumberObject2(Fraction(Integer(5), Integer(7)), 3322);
+        TestBench.run("BigFloatDivision", [&] {
+            NumberObject1.doDivision(NumberObject2);
+        });
+        TestBench.run("BigFloatExponent", [&] {
+            Mathematics::doExponentBigFloat(NumberObject1);
+        });
+        TestBench.run("BigFloatLogarithmE", [&] {
+            Mathematics::doLogarithmEBigFloat(NumberObject1);
+        });
+        TestBench.run("BigFloatSine", [&] {
+            Mathematics::doSineBigFloat(NumberObject1);
+        });
+    }
+}
+
+TEST_SUITE("Decimal") {
+    TEST_CASE("DecimalArithmetic") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        ArrayList<Decimal<4>> NumberList1, NumberList2;
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Decimal<4> NumberObject1(Fraction(getRandomInteger(RandomEngine() % 6 + 1), Integer(RandomEngine() % 1000 + 1))), NumberObject2(Fraction(getRandomInteger(RandomEngine() % 6 + 1), Integer(RandomEngine() % 1000 + 1)));
+            if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+            if (RandomEngine() & 1) NumberObject2 = NumberObject2.getOpposite();
+            Fraction NumberFraction1(NumberObject1.toFraction()), NumberFraction2(NumberObject2.toFraction());
+            CHECK(NumberObject1.doAddition(NumberObject2).toFraction().doCompare(NumberFraction1.doAddition(NumberFraction2)) == 0);
+            CHECK(NumberObject1.doSubtraction(NumberObject2).toFraction().doCompare(NumberFraction1.doSubtraction(NumberFraction2)) == 0);
+            CHECK(NumberObject1.doMultiplication(NumberObject2).doCompare(Decimal<4>(NumberFraction1.doMultiplication(NumberFraction2))) == 0);
+            if (NumberObject2.doCompare(0)) CHECK(NumberObject1.doDivision(NumberObject2).doCompare(Decimal<4>(NumberFraction1.doDivision(NumberFraction2))) == 0);
+            CHECK(NumberObject1.doCompare(NumberObject2) == NumberFraction1.doCompare(NumberFraction2));
+            CHECK(Decimal<4>(NumberObject1.toString()).doCompare(NumberObject1) == 0);
+            CHECK(NumberObject1.doRound(2).doCompare(Decimal<4>(Decimal<2>(NumberFraction1).toFraction())) == 0);
+            NumberList1.addElement(NumberObject1);
+            NumberList2.addElement(NumberObject2);
+        }
+        ArrayList<Decimal<4>> NumberAddition(Mathematics::doAdditionBatch(NumberList1, NumberList2)), NumberMultiplication(Mathematics::doMultiplicationBatch(NumberList1, NumberList2)), NumberRound;
+        NumberRound = Mathematics::doRoundBatch(NumberList1, 1);
+        for (intmax_t NumberIndex = 0; NumberIndex < NumberList1.getElementSize(); ++NumberIndex) {
+            CHECK(NumberAddition.getElement(NumberIndex).doCompare(NumberList1.getElement(NumberIndex).doAddition(NumberList2.getElement(NumberIndex))) == 0);
+            CHECK(NumberMultiplication.getElement(NumberIndex).doCompare(NumberList1.getElement(NumberIndex).doMultiplication(NumberList2.getElement(NumberIndex))) == 0);
+            CHECK(NumberRound.getElement(NumberIndex).doCompare(NumberList1.getElement(NumberIndex).doRound(1)) == 0);
+        }
+        CHECK(Decimal<2>(String(u"-12.345")).toString().doCompare(String(u"-12.35")) == 0);
+        CHECK(Decimal<2>(String(u".5")).toString().doCompare(String(u"0.50")) == 0);
+        CHECK(Decimal<3>(Integer(-7)).toString().doCompare(String(u"-7.000")) == 0);
+        CHECK(Decimal<2>(String(u"2.5")).doRound(0).toInteger().doCompare(3) == 0);
+        CHECK(Decimal<2>(1).doDivision(Decimal<2>(3)).toString().doCompare(String(u"0.33")) == 0);
+        CHECK(Decimal<0>(String(u"42")).toString().doCompare(String(u"42")) == 0);
+        CHECK(Decimal<0>(String(u"-9223372036854775808")).getUnscaledValue() == std::numeric_limits<intmax_t>::min());
+        CHECK(Decimal<0>(Integer(std::numeric_limits<intmax_t>::min())).getUnscaledValue() == std::numeric_limits<intmax_t>::min());
+        CHECK(Decimal<0>(Decimal<0>(std::numeric_limits<intmax_t>::min()).toFraction()).getUnscaledValue() == std::numeric_limits<intmax_t>::min());
+        CHECK_THROWS(Decimal<0>(String(u"9223372036854775808")));
+        CHECK_THROWS(Decimal<0>(Integer(std::numeric_limits<intmax_t>::min()).doSubtraction(1)));
+        CHECK_THROWS(Decimal<2>(String(u"1.2.3")));
+        CHECK_THROWS(Decimal<2>(String(u"-")));
+        CHECK_THROWS(Decimal<2>(1).doDivision(Decimal<2>()));
+        CHECK_THROWS(Decimal<18>(10));
+        CHECK_THROWS(Decimal<4>(Integer(1).doShiftLeftAssign(60)));
+        CHECK_THROWS(Decimal<9>(4000000000).doMultiplication(Decimal<9>(4000000000)));
+        ArrayList<Decimal<0>> NumberMaximum, NumberOne;
+        NumberMaximum.addElement(std::numeric_limits<intmax_t>::max());
+        NumberOne.addElement(1);
+        CHECK_THROWS(Mathematics::doAdditionBatch(NumberMaximum, NumberOne));
+        CHECK_THROWS(Mathematics::doMultiplicationBatch(NumberList1, ArrayList<Decimal<4>>()));
+
+        TestBench.run("DecimalAdditionBatch", [&] {
+            Mathematics::doAdditionBatch(NumberList1, NumberList2);
+        });
+        TestBench.run("DecimalMultiplicationBatch", [&] {
+            Mathematics::doMultiplicationBatch(NumberList1, NumberList2);
+        });
+        TestBench.run("DecimalRoundBatch", [&] {
+            Mathematics::doRoundBatch(NumberList1, 2);
+        });
+        Fraction NumberFraction1(NumberList1.getElement(0).toFraction()), NumberFraction2(NumberList2.getElement(0).toFraction());
+        TestBench.run("DecimalMultiplicationFraction", [&] {
+            NumberFraction1.doMultiplication(NumberFraction2);
+        });
+    }
+}
+
+TEST_SUITE("Fraction") {
+    TEST_CASE("FractionArithmetic") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberFactor(getRandomInteger(RandomEngine() % 16 + 1)), NumberNumerator1(getRandomInteger(RandomEngine() % 32 + 1)), NumberNumerator2(getRandomInteger(RandomEngine() % 32 + 1));
+            Integer NumberDenominator1(getRandomInteger(RandomEngine() % 32 + 1).doMultiplication(NumberFactor).doAddition(1)), NumberDenominator2(getRandomInteger(RandomEngine() % 32 + 1).doMultiplication(NumberFactor).doAddition(1));
+            if (RandomEngine() & 1) NumberNumerator1 = NumberNumerator1.getOpposite();
+            if (RandomEngine() & 1) NumberNumerator2 = NumberNumerator2.getOpposite();
+            if (!(RandomEngine() & 7)) NumberNumerator1 = 0;
+            Fraction NumberObject1(NumberNumerator1, NumberDenominator1), NumberObject2(NumberNumerator2, NumberDenominator2);
+            Fraction NumberAddition(NumberNumerator1.doMultiplication(NumberDenominator2).doAddition(NumberNumerator2.doMultiplication(NumberDenominator1)), NumberDenominator1.doMultiplication(NumberDenominator2));
+            Fraction NumberSubtraction(NumberNumerator1.doMultiplication(NumberDenominator2).doSubtraction(NumberNumerator2.doMultiplication(NumberDenominator1)), NumberDenominator1.doMultiplication(NumberDenominator2));
+            Fraction NumberMultiplication(NumberNumerator1.doMultiplication(NumberNumerator2), NumberDenominator1.doMultiplication(NumberDenominator2));
+            Fraction NumberResult(NumberObject1.doAddition(NumberObject2));
+            CHECK(NumberResult.getNumerator().doCompare(NumberAddition.getNumerator()) == 0);
+            CHECK(NumberResult.getDenominator().doCompare(NumberAddition.getDenominator()) == 0);
+            CHECK(NumberResult.isNegative() == NumberAddition.isNegative());
+            NumberResult = NumberObject1.doSubtraction(NumberObject2);
+            CHECK(NumberResult.getNumerator().doCompare(NumberSubtraction.getNumerator()) == 0);
+            CHECK(NumberResult.getDenominator().doCompare(NumberSubtraction.getDenominator()) == 0);
+            CHECK(NumberResult.isNegative() == NumberSubtraction.isNegative());
+            NumberResult = NumberObject1.doMultiplication(NumberObject2);
+            CHECK(NumberResult.getNumerator().doCompare(NumberMultiplication.getNumerator()) == 0);
+            CHECK(NumberResult.getDenominator().doCompare(NumberMultiplication.getDenominator()) == 0);
+            CHECK(NumberResult.isNegative() == NumberMultiplication.isNegative());
+            if (NumberNumerator2.doCompare(0)) CHECK(NumberObject1.doDivision(NumberObject2).doMultiplication(NumberObject2).doCompare(NumberObject1) == 0);
+            CHECK(NumberObject1.doCompare(NumberObject2) == NumberNumerator1.doMultiplication(NumberDenominator2).doCompare(NumberNumerator2.doMultiplication(NumberDenominator1)));
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberFactor(getRandomInteger(RandomEngine() % 64 + 1).doAddition(1)), NumberNumerator(getRandomInteger(RandomEngine() % 64 + 1).doAddition(1)), NumberDenominator(getRandomInteger(RandomEngine() % 64 + 1).doAddition(1));
+            Fraction NumberObject(NumberNumerator, NumberDenominator);
+            CHECK(NumberObject.doCompare(Fraction(NumberNumerator.doMultiplication(NumberFactor), NumberDenominator.doMultiplication(NumberFactor))) == 0);
+            CHECK(NumberObject.doCompare(Fraction(NumberNumerator.doMultiplication(NumberFactor).doAddition(1), NumberDenominator.doMultiplication(NumberFactor))) < 0);
+            CHECK(NumberObject.doCompare(Fraction(NumberNumerator.doMultiplication(NumberFactor).doSubtraction(1), NumberDenominator.doMultiplication(NumberFactor))) > 0);
+            CHECK(NumberObject.getOpposite().doCompare(Fraction(NumberNumerator.doMultiplication(NumberFactor).doAddition(1), NumberDenominator.doMultiplication(NumberFactor)).getOpposite()) > 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            intmax_t NumberNumerator = (intmax_t) (RandomEngine() & 1 ? RandomEngine() : -RandomEngine()) << 20, NumberDenominator = (intmax_t) (RandomEngine() | 1) << (RandomEngine() % 20);
+            CHECK(Fraction(Integer(NumberNumerator), Integer(NumberDenominator)).getValue() == (double) NumberNumerator / (double) NumberDenominator);
+            CHECK(Fraction(Integer(NumberNumerator >> 28), Integer(NumberDenominator & 0xFFFFFF)).getValue<float>() == (float) (NumberNumerator >> 28) / (float) (NumberDenominator & 0xFFFFFF));
+        }
+        CHECK(Fraction(Integer(1).doShiftLeftAssign(2000).doAddition(1), Integer(1).doShiftLeftAssign(1999)).getValue() == 2.0);
+        CHECK(Fraction(Integer(1).doShiftLeftAssign(2000), Integer(3)).getValue() == std::numeric_limits<double>::infinity());
+        CHECK(Fraction(Integer(-1), Integer(1).doShiftLeftAssign(1074)).getValue() == -std::numeric_limits<double>::denorm_min());
+        CHECK(Fraction(Integer(1), Integer(1).doShiftLeftAssign(1075)).getValue() == 0.0);
+        CHECK(Fraction(Integer(1), Integer(3)).toDecimalString(5).doCompare(String(u"0.33333")) == 0);
+        CHECK(Fraction(Integer(-2), Integer(3)).toDecimalString(3).doCompare(String(u"-0.667")) == 0);
+        CHECK(Fraction(Integer(22), Integer(7)).toDecimalString(0).doCompare(String(u"3")) == 0);
+        CHECK(Fraction(Integer(1), Integer(8)).toDecimalString(2).doCompare(String(u"0.13")) == 0);
+        CHECK(Fraction(Integer(-1), Integer(1000)).toDecimalString(2).doCompare(String(u"0.00")) == 0);
+        CHECK(Fraction(Integer(-1), Integer(200)).toDecimalString(2).doCompare(String(u"-0.01")) == 0);
+        Fraction NumberEager(1), NumberLazy(1), NumberStep(Integer(-7), Integer(12));
+        NumberLazy.setLazy(true);
+        for (unsigned NumberEpoch = 1; NumberEpoch <= 200; ++NumberEpoch) {
+            Fraction NumberTerm(Integer(NumberEpoch), Integer(NumberEpoch % 7 + 1));
+            NumberEager = NumberEager.doMultiplicationAddition(NumberStep, NumberTerm);
+            NumberLazy = NumberLazy.doMultiplicationAddition(NumberStep, NumberTerm);
+        }
+        CHECK(NumberLazy.isLazy());
+        CHECK(NumberLazy.doCompare(NumberEager) == 0);
+        CHECK(NumberLazy.getNumerator().doCompare(NumberEager.getNumerator()) == 0);
+        CHECK(!NumberLazy.setLazy(false).isLazy());
+        CHECK(NumberLazy.getDenominator().doCompare(NumberEager.getDenominator()) == 0);
+        CHECK(Fraction(0).doSubtraction(Fraction(Integer(-1), Integer(2))).doCompare(Fraction(Integer(1), Integer(2))) == 0);
+        CHECK(Fraction(Integer(-1), Integer(2)).doCompare(Fraction(Integer(-1), Integer(3))) < 0);
+        CHECK(!Fraction(0).getOpposite().isNegative());
+        CHECK_THROWS(Fraction(1).doDivision(Fraction(0)));
+
+        Fraction NumberAddition1(getRandomInteger(256), getRandomInteger(256)), NumberAddition2(getRandomInteger(256), getRandomInteger(256));
+        TestBench.run("FractionAddition", [&] {
+            NumberAddition1.doAddition(NumberAddition2);
+        });
+        TestBench.run("FractionMultiplication", [&] {
+            NumberAddition1.doMultiplication(NumberAddition2);
+        });
+        TestBench.run("FractionComparison", [&] {
+            NumberAddition1.doCompare(NumberAddition2);
+        });
+        TestBench.run("FractionDecimalString", [&] {
+            NumberAddition1.toDecimalString(100);
+        });
+        TestBench.run("FractionValue", [&] {
+            NumberAddition1.getValue();
+        });
+        Fraction NumberLazy1(NumberAddition1), NumberLazy2(NumberAddition2);
+        NumberLazy1.setLazy(true);
+        TestBench.run("FractionLazyAddition", [&] {
+            NumberLazy1.doAddition(NumberLazy2);
+        });
+    }
+}
+
 TEST_SUITE("Integer") {
+    TEST_CASE("IntegerAccumulator") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 100; ++NumberEpoch) {
+            ArrayList<Integer> NumberList1, NumberList2;
+            Integer NumberDotProduct, NumberSummation;
+            IntegerAccumulator NumberAccumulator;
+            for (unsigned NumberIndex = RandomEngine() % 200; NumberIndex > 0; --NumberIndex) {
+                Integer NumberObject1(getRandomInteger(RandomEngine() % 200 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 200 + 1));
+                if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+                if (RandomEngine() & 1) NumberObject2 = NumberObject2.getOpposite();
+                NumberList1.addElement(NumberObject1);
+                NumberList2.addElement(NumberObject2);
+                NumberDotProduct.doAdditionAssign(NumberObject1.doMultiplication(NumberObject2));
+                NumberSummation.doAdditionAssign(NumberObject1);
+                NumberAccumulator.doSubtractionAssign(NumberObject2).doMultiplicationSubtractionAssign(NumberObject1, NumberObject1);
+            }
+            CHECK(Mathematics::doDotProduct(NumberList1, NumberList2).doCompare(NumberDotProduct) == 0);
+            CHECK(Mathematics::doSummation(NumberList1).doCompare(NumberSummation) == 0);
+            Integer NumberExpected;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberList1.getElementSize(); ++NumberIndex)
+                NumberExpected.doSubtractionAssign(NumberList2.getElement(NumberIndex)).doSubtractionAssign(NumberList1.getElement(NumberIndex).doMultiplication(NumberList1.getElement(NumberIndex)));
+            CHECK(NumberAccumulator.getValue().doCompare(NumberExpected) == 0);
+        }
+        ArrayList<Integer> NumberEmpty, NumberSingle;
+        NumberSingle.addElement(1);
+        CHECK(Mathematics::doSummation(NumberEmpty).doCompare(0) == 0);
+        CHECK_THROWS(Mathematics::doDotProduct(NumberEmpty, NumberSingle));
+
+        ArrayList<Integer> NumberBench1, NumberBench2;
+        for (unsigned NumberIndex = 0; NumberIndex < 10000; ++NumberIndex) {
+            NumberBench1.addElement(getRandomInteger(32));
+            NumberBench2.addElement(getRandomInteger(32));
+        }
+        TestBench.run("IntegerAccumulatorDotProduct10000", [&] {
+            Mathematics::doDotProduct(NumberBench1, NumberBench2);
+        });
+        TestBench.run("IntegerAccumulatorDotProductSeparate10000", [&] {
+            Integer NumberResult;
+            for (intmax_t NumberIndex = 0; NumberIndex < NumberBench1.getElementSize(); ++NumberIndex)
+                NumberResult.doAdditionAssign(NumberBench1.getElement(NumberIndex).doMultiplication(NumberBench2.getElement(NumberIndex)));
+        });
+        TestBench.run("IntegerAccumulatorSummation10000", [&] {
+            Mathematics::doSummation(NumberBench1);
+        });
+    }
+
     TEST_CASE("IntegerAddition") {
         RandomEngine.seed(RandomDevice() + time(nullptr));
 
@@ -26,10 +298,97 @@ TEST_SUITE("Integer") {
 
             CHECK(NumberObject1.doAddition(NumberObject2).doCompare(Number1 + Number2) == 0);
         }
+        for (unsigned NumberSize = 1; NumberSize < 100; ++NumberSize) {
+            Integer NumberCarry = Integer(1).doShiftLeft(NumberSize * 64 + RandomEngine() % 64);
+            CHECK(NumberCarry.doSubtraction(1).doAddition(1).doCompare(NumberCarry) == 0);
+        }
         Integer NumberP1(RandomEngine()), NumberP2(RandomEngine());
         TestBench.run("IntegerAdditionPP", [&] {
             NumberP1.doAddition(NumberP2);
         });
+        Integer NumberL1(getRandomInteger(16384)), NumberL2(getRandomInteger(16384));
+        TestBench.run("IntegerAddition16384", [&] {
+            NumberL1.doAddition(NumberL2);
+        });
+    }
+
+    TEST_CASE("IntegerAssignment") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 2000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 2000 + 1));
+            if (!NumberObject2.doCompare(0)) continue;
+            if (RandomEngine() & 1) NumberObject1 = std::move(NumberObject1).getOpposite();
+            if (RandomEngine() & 1) NumberObject2 = std::move(NumberObject2).getOpposite();
+            Integer NumberAddition(NumberObject1), NumberDivision(NumberObject1), NumberModulo(NumberObject1), NumberMultiplication(NumberObject1), NumberSubtraction(NumberObject1), NumberSquare(NumberObject1);
+            uintmax_t NumberShift = RandomEngine() % 300;
+
+            CHECK(NumberAddition.doAdditionAssign(NumberObject2).doCompare(NumberObject1.doAddition(NumberObject2)) == 0);
+            CHECK(NumberDivision.doDivisionAssign(NumberObject2).doCompare(NumberObject1.doDivision(NumberObject2)) == 0);
+            CHECK(NumberModulo.doModuloAssign(NumberObject2).doCompare(NumberObject1.doModulo(NumberObject2)) == 0);
+            CHECK(NumberMultiplication.doMultiplicationAssign(NumberObject2).doCompare(NumberObject1.doMultiplication(NumberObject2)) == 0);
+            CHECK(NumberSubtraction.doSubtractionAssign(NumberObject2).doCompare(NumberObject1.doSubtraction(NumberObject2)) == 0);
+            CHECK(NumberSquare.doMultiplicationAssign(NumberSquare).doCompare(NumberObject1.doMultiplication(NumberObject1)) == 0);
+            CHECK(Integer(NumberObject1).doShiftLeftAssign(NumberShift).doCompare(NumberObject1.doMultiplication(Integer(2).doPower(NumberShift))) == 0);
+            CHECK(Integer(NumberObject1).doShiftRightAssign(NumberShift).doCompare(NumberObject1.doDivision(Integer(2).doPower(NumberShift))) == 0);
+            CHECK(Integer(NumberObject1).doAddition(NumberObject2).doMultiplication(NumberObject2).doCompare(NumberObject1.doAddition(NumberObject2).doMultiplication(NumberObject2)) == 0);
+            CHECK(Integer(NumberObject1).getAbsolute().doCompare(NumberObject1.getAbsolute()) == 0);
+
+            NumberAddition = NumberObject1;
+            CHECK(NumberAddition.doAdditionAssign(NumberAddition).doCompare(NumberObject1.doMultiplication(2)) == 0);
+            CHECK(NumberAddition.doSubtractionAssign(NumberAddition).doCompare(0) == 0);
+            if (NumberModulo.doCompare(0)) CHECK(NumberModulo.doModuloAssign(NumberModulo).doCompare(0) == 0);
+
+            Integer NumberMoved(std::move(NumberObject1));
+            CHECK(NumberObject1.doCompare(0) == 0);
+            CHECK(!NumberObject1.isNegative());
+        }
+        Integer NumberBase(getRandomInteger(2048)), NumberModulo(getRandomInteger(2048)), NumberObject1(NumberBase), NumberObject2(NumberBase);
+        TestBench.run("IntegerMultiplicationModuloAssign", [&] {
+            NumberObject1.doMultiplicationAssign(NumberBase).doModuloAssign(NumberModulo);
+        });
+        TestBench.run("IntegerMultiplicationModuloCopy", [&] {
+            NumberObject2 = NumberObject2.doMultiplication(NumberBase).doModulo(NumberModulo);
+        });
+    }
+
+    TEST_CASE("IntegerBitwise") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            auto NumberSource1 = (intmax_t) ((uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 64), NumberSource2 = (intmax_t) ((uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 64);
+            auto NumberMagnitude = (uint64_t) (NumberSource1 < 0 ? -(uint64_t) NumberSource1 : NumberSource1);
+            unsigned short NumberBit = RandomEngine() % 64;
+            Integer NumberObject1(NumberSource1), NumberObject2(NumberSource2);
+
+            CHECK(NumberObject1.doBitwiseAnd(NumberObject2).doCompare(NumberSource1 & NumberSource2) == 0);
+            CHECK(NumberObject1.doBitwiseOr(NumberObject2).doCompare(NumberSource1 | NumberSource2) == 0);
+            CHECK(NumberObject1.doBitwiseXor(NumberObject2).doCompare(NumberSource1 ^ NumberSource2) == 0);
+            CHECK(Integer(NumberObject1).doBitwiseXorAssign(NumberObject1).doCompare(0) == 0);
+            CHECK(NumberObject1.getBitLength() == (size_t) std::bit_width(NumberMagnitude));
+            CHECK(NumberObject1.getTrailingZeroCount() == (NumberMagnitude ? (size_t) std::countr_zero(NumberMagnitude) : 0));
+            CHECK(NumberObject1.isBitSet(NumberBit) == (bool) (NumberMagnitude >> NumberBit & 1));
+            CHECK(NumberObject1.doShiftRight(NumberBit).doCompare(NumberObject1.doDivision(Integer(2).doPower(NumberBit))) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 2000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 2000 + 1));
+            if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+            if (RandomEngine() & 1) NumberObject2 = NumberObject2.getOpposite();
+            uintmax_t NumberShift = RandomEngine() % 3000;
+
+            CHECK(NumberObject1.doBitwiseAnd(NumberObject2).doAddition(NumberObject1.doBitwiseOr(NumberObject2)).doCompare(NumberObject1.doAddition(NumberObject2)) == 0);
+            CHECK(NumberObject1.doBitwiseOr(NumberObject2).doSubtraction(NumberObject1.doBitwiseAnd(NumberObject2)).doCompare(NumberObject1.doBitwiseXor(NumberObject2)) == 0);
+            CHECK(NumberObject1.doShiftLeft(NumberShift).doShiftRight(NumberShift).doCompare(NumberObject1) == 0);
+            CHECK(NumberObject1.doShiftLeft(NumberShift).getTrailingZeroCount() == NumberObject1.getTrailingZeroCount() + (NumberObject1.doCompare(0) ? NumberShift : 0));
+            CHECK(Mathematics::getTrailingZeroCount(NumberObject1.doShiftLeft(NumberShift)).doCompare(NumberObject1.doShiftLeft(NumberShift).getTrailingZeroCount()) == 0);
+        }
+        Integer NumberObject1(getRandomInteger(2048)), NumberObject2(getRandomInteger(2048).getOpposite());
+        TestBench.run("IntegerBitwiseXor", [&] {
+            NumberObject1.doBitwiseXorAssign(NumberObject2);
+        });
+        TestBench.run("IntegerShiftLeft", [&] {
+            NumberObject1.doShiftLeft(1000);
+        });
     }
 
     TEST_CASE("IntegerComparison") {
@@ -43,12 +402,47 @@ TEST_SUITE("Integer") {
             if (Number1 == Number2) CHECK(NumberObject1.doCompare(NumberObject2) == 0);
             if (Number1 < Number2) CHECK(NumberObject1.doCompare(NumberObject2) < 0);
         }
+        for (unsigned NumberSize = 1; NumberSize < 100; ++NumberSize) {
+            Integer NumberObject1(getRandomInteger(NumberSize * 16)), NumberObject2 = NumberObject1.doAddition(1);
+            CHECK(NumberObject1.doCompare(NumberObject2) < 0);
+            CHECK(NumberObject2.doCompare(NumberObject1) > 0);
+            CHECK(NumberObject1.doCompare(NumberObject2.doSubtraction(1)) == 0);
+        }
         Integer NumberObject1(RandomEngine()), NumberObject2(RandomEngine());
         TestBench.run("IntegerComparisonPP", [&] {
             ankerl::nanobench::doNotOptimizeAway(NumberObject1.doCompare(NumberObject2));
         });
     }
 
+    TEST_CASE("IntegerConversion") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            intmax_t NumberSource = (intmax_t) ((uint64_t) RandomEngine() << 32 | RandomEngine());
+            CHECK(Integer(NumberSource).toString().doCompare(String(std::to_string(NumberSource))) == 0);
+            CHECK(Integer(String(std::to_string(NumberSource))).doCompare(NumberSource) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberSource(getRandomInteger(RandomEngine() % 10000 + 1));
+            if (RandomEngine() & 1) NumberSource = NumberSource.getOpposite();
+            auto NumberRadix = (unsigned short) (RandomEngine() % 35 + 2);
+            CHECK(Integer(NumberSource.toString(NumberRadix), NumberRadix).doCompare(NumberSource) == 0);
+            CHECK(Integer(NumberSource.toString(NumberRadix).toLowerCase(), NumberRadix).doCompare(NumberSource) == 0);
+        }
+        Integer NumberObject(String(u"-123456789012345678901234567890123456789012345678901234567890"));
+        TestBench.run("IntegerConversion", [&] {
+            NumberObject.toString();
+        });
+        Integer NumberObjectLarge(getRandomInteger(100000));
+        String NumberObjectString(NumberObjectLarge.toString());
+        TestBench.run("IntegerConversionParse", [&] {
+            Integer NumberResult(NumberObjectString);
+        });
+        TestBench.run("IntegerConversionPrint", [&] {
+            NumberObjectLarge.toString();
+        });
+    }
+
     TEST_CASE("IntegerDivision") {
         RandomEngine.seed(RandomDevice() + time(nullptr));
 
@@ -58,10 +452,184 @@ TEST_SUITE("Integer") {
 
             CHECK(NumberObject1.doDivision(NumberObject2).doCompare(Number1 / Number2) == 0);
         }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 100; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 40000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 20000 + 1));
+            if (!NumberObject2.doCompare(0)) continue;
+            auto [NumberQuotient, NumberRemainder] = NumberObject1.doDivisionModulo(NumberObject2);
+            CHECK(NumberQuotient.doMultiplication(NumberObject2).doAddition(NumberRemainder).doCompare(NumberObject1) == 0);
+            CHECK(NumberRemainder.doCompare(NumberObject2) < 0);
+            CHECK(NumberQuotient.doCompare(NumberObject1.doDivision(NumberObject2)) == 0);
+        }
         Integer NumberP1(RandomEngine()), NumberP2(RandomEngine());
         TestBench.run("IntegerDivisionPP", [&] {
             NumberP1.doDivision(NumberP2);
         });
+        Integer NumberKnuth1(getRandomInteger(2048)), NumberKnuth2(getRandomInteger(1024));
+        TestBench.run("IntegerDivisionKnuth", [&] {
+            NumberKnuth1.doDivisionModulo(NumberKnuth2);
+        });
+        Integer NumberBurnikelZiegler1(getRandomInteger(65536)), NumberBurnikelZiegler2(getRandomInteger(32768));
+        TestBench.run("IntegerDivisionBurnikelZiegler", [&] {
+            NumberBurnikelZiegler1.doDivisionModulo(NumberBurnikelZiegler2);
+        });
+    }
+
+    TEST_CASE("IntegerFactorial") {
+        Integer NumberFactorial(1);
+        for (unsigned NumberSource = 0; NumberSource <= 500; ++NumberSource) {
+            if (NumberSource) NumberFactorial.doMultiplicationAssign(NumberSource);
+            CHECK(Mathematics::getFactorial(NumberSource).doCompare(NumberFactorial) == 0);
+        }
+        for (unsigned NumberN = 0; NumberN <= 100; ++NumberN) {
+            Integer NumberBinomial(1);
+            for (unsigned NumberK = 0; NumberK <= NumberN; ++NumberK) {
+                CHECK(Mathematics::getBinomial(NumberN, NumberK).doCompare(NumberBinomial) == 0);
+                NumberBinomial.doMultiplicationAssign(NumberN - NumberK).doDivisionAssign(NumberK + 1);
+            }
+            CHECK(Mathematics::getBinomial(NumberN, NumberN + 1).doCompare(0) == 0);
+        }
+        CHECK(Mathematics::getBinomial(3000, 1000).doMultiplication(Mathematics::getFactorial(1000)).doMultiplication(Mathematics::getFactorial(2000)).doCompare(Mathematics::getFactorial(3000)) == 0);
+        Integer NumberPrimorial(1);
+        for (unsigned NumberSource = 0; NumberSource <= 1000; ++NumberSource) {
+            if (Mathematics::isPrimeNative(NumberSource)) NumberPrimorial.doMultiplicationAssign(NumberSource);
+            CHECK(Mathematics::getPrimorial(NumberSource).doCompare(NumberPrimorial) == 0);
+        }
+
+        TestBench.run("IntegerFactorial20000", [&] {
+            Mathematics::getFactorial(20000);
+        });
+        TestBench.run("IntegerFactorialSeparate20000", [&] {
+            Integer NumberResult(1);
+            for (unsigned NumberSource = 2; NumberSource <= 20000; ++NumberSource) NumberResult.doMultiplicationAssign(NumberSource);
+        });
+        TestBench.run("IntegerBinomial100000", [&] {
+            Mathematics::getBinomial(100000, 50000);
+        });
+        TestBench.run("IntegerPrimorial1000000", [&] {
+            Mathematics::getPrimorial(1000000);
+        });
+    }
+
+    TEST_CASE("IntegerFixed") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 20 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 11 + 1));
+            if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+            if (RandomEngine() & 1) NumberObject2 = NumberObject2.getOpposite();
+            FixedInteger<128, true> NumberFixed1(NumberObject1), NumberFixed2(NumberObject2);
+            CHECK(NumberFixed1.toInteger().doCompare(NumberObject1) == 0);
+            CHECK(NumberFixed1.doAddition(NumberFixed2).toInteger().doCompare(NumberObject1.doAddition(NumberObject2)) == 0);
+            CHECK(NumberFixed1.doSubtraction(NumberFixed2).toInteger().doCompare(NumberObject1.doSubtraction(NumberObject2)) == 0);
+            CHECK(NumberFixed1.doMultiplication(NumberFixed2).toInteger().doCompare(NumberObject1.doMultiplication(NumberObject2)) == 0);
+            CHECK(NumberFixed1.doCompare(NumberFixed2) == NumberObject1.doCompare(NumberObject2));
+            uintmax_t NumberShift = RandomEngine() % 130;
+            CHECK(NumberFixed1.doShiftRight(NumberShift).toInteger().doCompare(NumberObject1.doShiftRight(NumberShift)) == 0);
+            if (!NumberObject2.doCompare(0)) continue;
+            CHECK(NumberFixed1.doDivision(NumberFixed2).toInteger().doCompare(NumberObject1.doDivision(NumberObject2)) == 0);
+            CHECK(NumberFixed1.doModulo(NumberFixed2).toInteger().doCompare(NumberObject1.doModulo(NumberObject2)) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 128 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 64 + 1)), NumberObject3(getRandomInteger(RandomEngine() % 64 + 1));
+            if (!NumberObject3.doCompare(0)) continue;
+            FixedInteger<512> NumberFixed1(NumberObject1), NumberFixed2(NumberObject2), NumberFixed3(NumberObject3);
+            CHECK(NumberFixed1.toString(16).doCompare(NumberObject1.toString(16)) == 0);
+            CHECK(NumberFixed1.doModulo(NumberFixed3).doMultiplicationModulo(NumberFixed2, NumberFixed3).toInteger().doCompare(NumberObject1.doMultiplicationModulo(NumberObject2, NumberObject3)) == 0);
+            CHECK(NumberFixed2.doPower(NumberFixed1, NumberFixed3).toInteger().doCompare(NumberObject2.doPower(NumberObject1, NumberObject3)) == 0);
+        }
+        static_assert(FixedInteger<128>(1).doShiftLeft(127).doSubtraction(1).getBitLength() == 127);
+        static_assert(FixedInteger<128, true>(-7).doDivision(2).doCompare(-3) == 0);
+        static_assert(FixedInteger<128, true>(-1).doShiftRight(1).doCompare(0) == 0);
+        static_assert(FixedInteger<128, true>(-7).doShiftRight(1).doCompare(-3) == 0);
+        static_assert(FixedInteger<256>(3).doPower(200, FixedInteger<256>(1000000007)).doCompare(136318165) == 0);
+        static_assert(Mathematics::isPrime(FixedInteger<128>(1).doShiftLeft(127).doSubtraction(1)));
+        static_assert(!Mathematics::isPrime(FixedInteger<128>(1).doShiftLeft(61).doSubtraction(1).doMultiplication(FixedInteger<128>(1).doShiftLeft(31).doSubtraction(1))));
+        CHECK_THROWS(FixedInteger<64>(1).doDivision(0));
+        CHECK_THROWS(FixedInteger<128>(1).doShiftLeft(100).getValue());
+
+        FixedInteger<256> NumberMultiplication1(getRandomInteger(64)), NumberMultiplication2(getRandomInteger(64));
+        TestBench.run("IntegerFixedMultiplication256", [&] {
+            NumberMultiplication1.doMultiplication(NumberMultiplication2);
+        });
+        Integer NumberMultiplicationObject1(NumberMultiplication1.toInteger()), NumberMultiplicationObject2(NumberMultiplication2.toInteger());
+        TestBench.run("IntegerFixedMultiplicationInteger256", [&] {
+            NumberMultiplicationObject1.doMultiplication(NumberMultiplicationObject2);
+        });
+        FixedInteger<128> NumberMersenne(FixedInteger<128>(1).doShiftLeft(127).doSubtraction(1));
+        TestBench.run("IntegerFixedPrime128", [&] {
+            Mathematics::isPrime(NumberMersenne);
+        });
+    }
+
+    TEST_CASE("IntegerGreatestCommonFactor") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            auto NumberSource1 = (intmax_t) ((uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 64), NumberSource2 = (intmax_t) ((uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 64);
+            CHECK(Integer(NumberSource1).getGreatestCommonFactor(NumberSource2).doCompare(std::gcd(NumberSource1, NumberSource2)) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberFactor(getRandomInteger(RandomEngine() % 500 + 1)), NumberObject1(getRandomInteger(RandomEngine() % 1000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 1000 + 1));
+            if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+            if (RandomEngine() & 1) NumberObject2 = NumberObject2.getOpposite();
+            Integer NumberResult(NumberObject1.doMultiplication(NumberFactor).getGreatestCommonFactor(NumberObject2.doMultiplication(NumberFactor)));
+
+            CHECK(!NumberResult.isNegative());
+            if (NumberFactor.doCompare(0)) CHECK(NumberResult.doModulo(NumberFactor).doCompare(0) == 0);
+            if (NumberResult.doCompare(0)) {
+                CHECK(NumberObject1.doMultiplication(NumberFactor).doModulo(NumberResult).doCompare(0) == 0);
+                CHECK(NumberObject2.doMultiplication(NumberFactor).doModulo(NumberResult).doCompare(0) == 0);
+            }
+            auto [NumberFactorExtended, NumberCoefficient1, NumberCoefficient2] = NumberObject1.getGreatestCommonFactorExtended(NumberObject2);
+            CHECK(NumberFactorExtended.doCompare(NumberObject1.getGreatestCommonFactor(NumberObject2)) == 0);
+            CHECK(NumberObject1.doMultiplication(NumberCoefficient1).doAddition(NumberObject2.doMultiplication(NumberCoefficient2)).doCompare(NumberFactorExtended) == 0);
+
+            Integer NumberModulo(NumberObject2.getAbsolute().doAddition(2));
+            if (NumberObject1.getGreatestCommonFactor(NumberModulo).doCompare(1) == 0) {
+                Integer NumberInverse(NumberObject1.getInverseModulo(NumberModulo));
+                CHECK(NumberInverse.doCompare(0) >= 0);
+                CHECK(NumberInverse.doCompare(NumberModulo) < 0);
+                Integer NumberProduct(NumberObject1.doMultiplication(NumberInverse).doModulo(NumberModulo));
+                if (NumberProduct.isNegative()) NumberProduct.doAdditionAssign(NumberModulo);
+                CHECK(NumberProduct.doCompare(1) == 0);
+            } else CHECK_THROWS(NumberObject1.getInverseModulo(NumberModulo));
+        }
+        CHECK_THROWS(Integer(3).getInverseModulo(0));
+        CHECK(Integer(0).getGreatestCommonFactor(0).doCompare(0) == 0);
+        CHECK(Fraction(Integer(-6), Integer(4)).getNumerator().doCompare(3) == 0);
+        CHECK(Fraction(Integer(-6), Integer(4)).getDenominator().doCompare(2) == 0);
+        Integer NumberObject1(getRandomInteger(512)), NumberObject2(getRandomInteger(512)), NumberModulo(Integer(1).doShiftLeft(2203).doSubtraction(1));
+        TestBench.run("IntegerGreatestCommonFactor2048", [&] {
+            NumberObject1.getGreatestCommonFactor(NumberObject2);
+        });
+        TestBench.run("IntegerInverseModuloMersenne2203", [&] {
+            NumberObject1.getInverseModulo(NumberModulo);
+        });
+    }
+
+    TEST_CASE("IntegerInline") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            unsigned __int128 Number1 = ((unsigned __int128) RandomEngine() << 96 | (unsigned __int128) RandomEngine() << 64 | (uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 128);
+            unsigned __int128 Number2 = ((unsigned __int128) RandomEngine() << 96 | (unsigned __int128) RandomEngine() << 64 | (uint64_t) RandomEngine() << 32 | RandomEngine()) >> (RandomEngine() % 128);
+            Integer NumberObject1(Number1), NumberObject2(Number2);
+
+            if (Number1 + Number2 >= Number1) CHECK(NumberObject1.doAddition(NumberObject2).doCompare(Number1 + Number2) == 0);
+            else CHECK(NumberObject1.doAddition(NumberObject2).doSubtraction(Integer(std::numeric_limits<unsigned __int128>::max()).doAddition(1)).doCompare(Number1 + Number2) == 0);
+            CHECK(NumberObject1.doSubtraction(NumberObject2).doCompare(Number1 >= Number2 ? Integer(Number1 - Number2) : Integer(Number2 - Number1).getOpposite()) == 0);
+            if (!(Number1 >> 64) && !(Number2 >> 64)) CHECK(NumberObject1.doMultiplication(NumberObject2).doCompare(Number1 * Number2) == 0);
+            if (Number2) {
+                CHECK(NumberObject1.doDivision(NumberObject2).doCompare(Number1 / Number2) == 0);
+                CHECK(NumberObject1.doModulo(NumberObject2).doCompare(Number1 % Number2) == 0);
+                CHECK(NumberObject1.getOpposite().doDivision(NumberObject2).doCompare(Integer(Number1 / Number2).getOpposite()) == 0);
+                CHECK(NumberObject1.getOpposite().doModulo(NumberObject2).doCompare(Integer(Number1 % Number2).getOpposite()) == 0);
+            }
+        }
+        Integer NumberSource(String(u"170141183460469231731687303715884105727"));
+        TestBench.run("IntegerJacobiSymbol", [&] {
+            Mathematics::getJocabiSymbol(Integer(RandomEngine()), NumberSource);
+        });
     }
 
     TEST_CASE("IntegerModulo") {
@@ -79,6 +647,38 @@ TEST_SUITE("Integer") {
         });
     }
 
+    TEST_CASE("IntegerMontgomery") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberModulo(getRandomInteger(RandomEngine() % 600 + 1).doMultiplication(2).doAddition(3));
+            MontgomeryContext NumberContext(NumberModulo);
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 600 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 600 + 1)), NumberExponent(getRandomInteger(RandomEngine() % 16 + 1));
+            Integer NumberMontgomery1(NumberContext.toMontgomery(NumberObject1)), NumberMontgomery2(NumberContext.toMontgomery(NumberObject2)), NumberPower(1);
+            for (Integer NumberIteration = 0; NumberIteration.doCompare(NumberExponent.doModulo(64)) < 0; NumberIteration.doAdditionAssign(1))
+                NumberPower.doMultiplicationAssign(NumberObject1).doModuloAssign(NumberModulo);
+
+            CHECK(NumberContext.fromMontgomery(NumberMontgomery1).doCompare(NumberObject1.doModulo(NumberModulo)) == 0);
+            CHECK(NumberContext.fromMontgomery(NumberContext.doMultiplication(NumberMontgomery1, NumberMontgomery2)).doCompare(NumberObject1.doMultiplication(NumberObject2).doModulo(NumberModulo)) == 0);
+            CHECK(NumberContext.fromMontgomery(NumberContext.doSquare(NumberMontgomery1)).doCompare(NumberObject1.doMultiplication(NumberObject1).doModulo(NumberModulo)) == 0);
+            CHECK(NumberContext.fromMontgomery(NumberContext.doPower(NumberMontgomery1, NumberExponent.doModulo(64))).doCompare(NumberPower) == 0);
+            CHECK(NumberObject1.doPower(NumberExponent, NumberModulo).doCompare(NumberObject1.doPower(NumberExponent, NumberModulo.doMultiplication(2)).doModulo(NumberModulo)) == 0);
+        }
+        Integer NumberModulo(getRandomInteger(512).doMultiplication(2).doAddition(1)), NumberBase(getRandomInteger(512)), NumberExponent(getRandomInteger(512));
+        MontgomeryContext NumberContext(NumberModulo);
+        Integer NumberMontgomery(NumberContext.toMontgomery(NumberBase));
+        TestBench.run("IntegerMontgomeryPower2048", [&] {
+            NumberContext.doPower(NumberMontgomery, NumberExponent);
+        });
+        TestBench.run("IntegerMontgomerySquare2048", [&] {
+            NumberContext.doSquareAssign(NumberMontgomery);
+        });
+        Integer NumberSquare(NumberBase);
+        TestBench.run("IntegerMultiplicationModulo2048", [&] {
+            NumberSquare.doMultiplicationAssign(NumberSquare).doModuloAssign(NumberModulo);
+        });
+    }
+
     TEST_CASE("IntegerMultiplication") {
         RandomEngine.seed(RandomDevice() + time(nullptr));
 
@@ -88,10 +688,91 @@ TEST_SUITE("Integer") {
 
             CHECK(NumberObject1.doMultiplication(NumberObject2).doCompare(Number1 * Number2) == 0);
         }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 100; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 20000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 20000 + 1)), NumberObject3(getRandomInteger(RandomEngine() % 20000 + 1));
+            CHECK(NumberObject1.doMultiplication(NumberObject2.doAddition(NumberObject3)).doCompare(NumberObject1.doMultiplication(NumberObject2).doAddition(NumberObject1.doMultiplication(NumberObject3))) == 0);
+            CHECK(NumberObject1.doMultiplicationNTT(NumberObject2).doCompare(NumberObject1.doMultiplication(NumberObject2)) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 200000 + 50000)), NumberObject2(getRandomInteger(RandomEngine() % 200000 + 50000)), NumberObject3(getRandomInteger(RandomEngine() % 200000 + 50000));
+            CHECK(NumberObject1.doMultiplication(NumberObject2.doAddition(NumberObject3)).doCompare(NumberObject1.doMultiplication(NumberObject2).doAddition(NumberObject1.doMultiplication(NumberObject3))) == 0);
+        }
         Integer NumberP1(RandomEngine()), NumberP2(RandomEngine());
         TestBench.run("IntegerMultiplicationPP", [&] {
             NumberP1.doMultiplication(NumberP2);
         });
+        for (unsigned NumberSize : {16, 32, 128, 256, 1024, 3072, 8192}) {
+            Integer NumberObject1(getRandomInteger(NumberSize << 4)), NumberObject2(getRandomInteger(NumberSize << 4));
+            TestBench.run("IntegerMultiplication" + std::to_string(NumberSize), [&] {
+                NumberObject1.doMultiplication(NumberObject2);
+            });
+            TestBench.run("IntegerMultiplicationNTT" + std::to_string(NumberSize), [&] {
+                NumberObject1.doMultiplicationNTT(NumberObject2);
+            });
+        }
+        Integer NumberL1(getRandomInteger(1 << 18)), NumberL2(getRandomInteger(1 << 18)), NumberL3(getRandomInteger(1 << 17));
+        Integer NumberProduct(NumberL1.doMultiplication(NumberL2)), NumberQuotient(NumberProduct.doDivision(NumberL3));
+        for (unsigned NumberThreadCount = 1; NumberThreadCount <= std::max(std::thread::hardware_concurrency(), 1u); NumberThreadCount <<= 1) {
+            Integer::setParallelism(NumberThreadCount);
+            CHECK(NumberL1.doMultiplication(NumberL2).doCompare(NumberProduct) == 0);
+            CHECK(NumberProduct.doDivision(NumberL3).doCompare(NumberQuotient) == 0);
+            TestBench.run("IntegerMultiplicationParallel" + std::to_string(NumberThreadCount), [&] {
+                NumberL1.doMultiplication(NumberL2);
+            });
+            TestBench.run("IntegerDivisionParallel" + std::to_string(NumberThreadCount), [&] {
+                NumberProduct.doDivision(NumberL3);
+            });
+        }
+        Integer::setParallelism(1);
+        CHECK_THROWS(Integer::setParallelism(0));
+    }
+
+    TEST_CASE("IntegerMultiplicationFused") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 10000; ++NumberEpoch) {
+            intmax_t Number1 = (intmax_t) (RandomEngine() % 20000000) - 10000000, Number2 = (intmax_t) (RandomEngine() % 20000000) - 10000000, Number3 = RandomEngine() & 1 ? (intmax_t) RandomEngine() : -(intmax_t) RandomEngine();
+            Integer NumberObject1(Number1), NumberObject2(Number2), NumberObject3(Number3);
+
+            CHECK(NumberObject1.doMultiplicationAddition(NumberObject2, NumberObject3).doCompare(Number1 * Number2 + Number3) == 0);
+            CHECK(NumberObject1.doMultiplicationSubtraction(NumberObject2, NumberObject3).doCompare(Number1 * Number2 - Number3) == 0);
+            CHECK(NumberObject1.doSquareSubtraction(NumberObject3).doCompare(Number1 * Number1 - Number3) == 0);
+            if (Number3) CHECK(NumberObject1.doMultiplicationModulo(NumberObject2, NumberObject3).doCompare(Number1 * Number2 % Number3) == 0);
+        }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 1000 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 1000 + 1)), NumberObject3(getRandomInteger(RandomEngine() % 2000 + 1));
+            if (RandomEngine() & 1) NumberObject1 = NumberObject1.getOpposite();
+            if (RandomEngine() & 1) NumberObject3 = NumberObject3.getOpposite();
+            Integer NumberProduct(NumberObject1.doMultiplication(NumberObject2)), NumberObject(NumberObject1);
+
+            CHECK(NumberObject1.doMultiplicationAddition(NumberObject2, NumberObject3).doCompare(NumberProduct.doAddition(NumberObject3)) == 0);
+            CHECK(NumberObject1.doMultiplicationSubtraction(NumberObject2, NumberObject3).doCompare(NumberProduct.doSubtraction(NumberObject3)) == 0);
+            CHECK(NumberObject1.doSquareSubtraction(NumberObject3).doCompare(NumberObject1.doMultiplication(NumberObject1).doSubtraction(NumberObject3)) == 0);
+            CHECK(NumberObject1.doMultiplicationModulo(NumberObject2, NumberObject3).doCompare(NumberProduct.doModulo(NumberObject3)) == 0);
+            CHECK(NumberObject.doMultiplicationAdditionAssign(NumberObject2, NumberObject).doCompare(NumberProduct.doAddition(NumberObject1)) == 0);
+            CHECK(NumberObject3.doMultiplicationModulo(NumberObject1, NumberObject3).doCompare(0) == 0);
+        }
+        CHECK_THROWS(Integer(1).doMultiplicationModulo(1, 0));
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberNumerator1(RandomEngine()), NumberNumerator2(RandomEngine()), NumberNumerator3(RandomEngine());
+            if (RandomEngine() & 1) NumberNumerator1 = NumberNumerator1.getOpposite();
+            if (RandomEngine() & 1) NumberNumerator2 = NumberNumerator2.getOpposite();
+            if (RandomEngine() & 1) NumberNumerator3 = NumberNumerator3.getOpposite();
+            Fraction NumberObject1(NumberNumerator1, Integer(RandomEngine() | 1)), NumberObject2(NumberNumerator2, Integer(RandomEngine() | 1)), NumberObject3(NumberNumerator3, Integer(RandomEngine() | 1));
+
+            CHECK(NumberObject1.doMultiplicationAddition(NumberObject2, NumberObject3).doCompare(NumberObject1.doMultiplication(NumberObject2).doAddition(NumberObject3)) == 0);
+            CHECK(NumberObject1.doMultiplicationSubtraction(NumberObject2, NumberObject3).doCompare(NumberObject1.doMultiplication(NumberObject2).doAddition(NumberObject3.getOpposite())) == 0);
+        }
+        Integer NumberModulo(getRandomInteger(256).doMultiplication(2).doAddition(1)), NumberObject1(getRandomInteger(256)), NumberObject2(getRandomInteger(256)), NumberObject3(getRandomInteger(512));
+        TestBench.run("IntegerMultiplicationAddition1024", [&] {
+            NumberObject1.doMultiplicationAddition(NumberObject2, NumberObject3);
+        });
+        TestBench.run("IntegerMultiplicationAdditionSeparate1024", [&] {
+            NumberObject1.doMultiplication(NumberObject2).doAdditionAssign(NumberObject3);
+        });
+        TestBench.run("IntegerMultiplicationModuloFused1024", [&] {
+            NumberObject3.doMultiplicationModuloAssign(NumberObject1, NumberModulo);
+        });
     }
 
     TEST_CASE("IntegerPower") {
@@ -105,10 +786,25 @@ TEST_SUITE("Integer") {
 
             CHECK(NumberBaseObject.doPower(NumberExponentObject).doCompare(NumberResult) == 0);
         }
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberBase(getRandomInteger(RandomEngine() % 200 + 1)), NumberExponent1(getRandomInteger(RandomEngine() % 200 + 1)), NumberExponent2(getRandomInteger(RandomEngine() % 200 + 1)), NumberModulo(getRandomInteger(RandomEngine() % 200 + 1).doAddition(2));
+            if (RandomEngine() & 1) NumberBase = NumberBase.getOpposite();
+            Integer NumberPower1(NumberBase.doPower(NumberExponent1, NumberModulo)), NumberPower2(NumberBase.doPower(NumberExponent2, NumberModulo));
+
+            CHECK(NumberBase.doPower(NumberExponent1.doAddition(NumberExponent2), NumberModulo).doCompare(NumberPower1.doMultiplication(NumberPower2).doModulo(NumberModulo)) == 0);
+            CHECK(NumberBase.doPower(NumberExponent1.doModulo(300)).doModulo(NumberModulo).doCompare(NumberBase.doPower(NumberExponent1.doModulo(300), NumberModulo)) == 0);
+        }
         Integer NumberBaseObject(std::min(RandomEngine(), (uint_fast32_t) 1000000)), NumberExponentObject(RandomEngine() % 1000);
         TestBench.run("IntegerPower", [&] {
             NumberBaseObject.doPower(NumberExponentObject);
         });
+        Integer NumberBase(getRandomInteger(512)), NumberExponent(getRandomInteger(512)), NumberModuloEven(getRandomInteger(512).doMultiplication(2)), NumberModuloOdd(NumberModuloEven.doAddition(1));
+        TestBench.run("IntegerPowerModuloEven2048", [&] {
+            NumberBase.doPower(NumberExponent, NumberModuloEven);
+        });
+        TestBench.run("IntegerPowerModuloOdd2048", [&] {
+            NumberBase.doPower(NumberExponent, NumberModuloOdd);
+        });
     }
 
     TEST_CASE("IntegerPrime") {
@@ -118,10 +814,81 @@ TEST_SUITE("Integer") {
             unsigned NumberTarget = RandomEngine() % 100000;
             CHECK(Mathematics::isPrime(NumberTarget) == Mathematics::isPrimeNative(NumberTarget));
         }
+        CHECK(Mathematics::isPrime(Integer(1).doShiftLeftAssign(521).doSubtraction(1)));
+        CHECK(Mathematics::isPrime(Integer(1).doShiftLeftAssign(607).doSubtraction(1)));
+        CHECK(!Mathematics::isPrime(Integer(1).doShiftLeftAssign(89).doSubtraction(1).doMultiplication(Integer(1).doShiftLeftAssign(107).doSubtraction(1))));
+        CHECK(!Mathematics::isPrime(Integer(String(u"318665857834031151167461"))));
+        CHECK(!Mathematics::isPrime(Integer(String(u"3317044064679887385961981"))));
         uintmax_t NumberSource = RandomEngine();
         TestBench.run("IntegerPrimeMixed", [&] {
             Mathematics::isPrime(NumberSource);
         });
+        Integer NumberMersenne(Integer(1).doShiftLeftAssign(2203).doSubtraction(1));
+        TestBench.run("IntegerPrimeMersenne2203", [&] {
+            Mathematics::isPrime(NumberMersenne);
+        });
+    }
+
+    TEST_CASE("IntegerRoot") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        for (unsigned NumberEpoch = 0; NumberEpoch < 1000; ++NumberEpoch) {
+            Integer NumberSource(getRandomInteger(RandomEngine() % 2000 + 1));
+            auto NumberDegree = (uintmax_t) (RandomEngine() % 10 + 1);
+            Integer NumberRoot(NumberSource.getSquareRoot()), NumberRootDegree(NumberSource.getRoot(NumberDegree));
+
+            CHECK(NumberRoot.doMultiplication(NumberRoot).doCompare(NumberSource) <= 0);
+            CHECK(NumberRoot.doAddition(1).doMultiplication(NumberRoot.doAddition(1)).doCompare(NumberSource) > 0);
+            CHECK(NumberRootDegree.doPower(NumberDegree).doCompare(NumberSource) <= 0);
+            CHECK(NumberRootDegree.doAddition(1).doPower(NumberDegree).doCompare(NumberSource) > 0);
+            CHECK(NumberSource.getOpposite().getRoot(3).doCompare(NumberSource.getRoot(3).getOpposite()) == 0);
+            CHECK(NumberRoot.doMultiplication(NumberRoot).isPerfectSquare());
+            if (NumberRoot.doCompare(0)) CHECK(!NumberRoot.doMultiplication(NumberRoot).doAddition(1).isPerfectSquare());
+        }
+        CHECK_THROWS(Integer(-4).getSquareRoot());
+        CHECK_THROWS(Integer(-4).getRoot(2));
+        CHECK_THROWS(Integer(4).getRoot(0));
+        CHECK(!Integer(-4).isPerfectSquare());
+        CHECK(!Mathematics::isPrimeLucas(Integer(1).doShiftLeft(521).doSubtraction(1).doPower(2)));
+        Integer NumberSource(getRandomInteger(512));
+        TestBench.run("IntegerSquareRoot2048", [&] {
+            NumberSource.getSquareRoot();
+        });
+        TestBench.run("IntegerRootCubic2048", [&] {
+            NumberSource.getRoot(3);
+        });
+    }
+
+    TEST_CASE("IntegerScratchScope") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        std::vector<Integer> NumberEscapeList;
+        std::vector<String> NumberExpectList;
+        for (unsigned NumberEpoch = 0; NumberEpoch < 100; ++NumberEpoch) {
+            Integer::ScratchScope NumberScope;
+            Integer NumberObject1(getRandomInteger(RandomEngine() % 200 + 1)), NumberObject2(getRandomInteger(RandomEngine() % 200 + 1));
+            {
+                Integer::ScratchScope NumberScopeNested;
+                Integer NumberProduct(NumberObject1.doMultiplication(NumberObject2));
+                CHECK(NumberProduct.doDivision(NumberObject2.doAddition(1)).doCompare(NumberObject1.doMultiplication(NumberObject2).doDivision(NumberObject2.doAddition(1))) == 0);
+                NumberExpectList.push_back(NumberProduct.toString(16));
+                NumberEscapeList.push_back(std::move(NumberProduct));
+            }
+            NumberExpectList.push_back(NumberObject1.toString(16));
+            NumberEscapeList.push_back(NumberObject1);
+        }
+        for (size_t NumberIndex = 0; NumberIndex < NumberEscapeList.size(); ++NumberIndex)
+            CHECK(NumberEscapeList[NumberIndex].doCompare(Integer(NumberExpectList[NumberIndex], 16)) == 0);
+        Fraction NumberExponent(Mathematics::doExponentFraction(Fraction(1, 3)));
+        CHECK(NumberExponent.doCompare(Fraction(Integer(13956), Integer(10000))) > 0);
+        CHECK(NumberExponent.doCompare(Fraction(Integer(13957), Integer(10000))) < 0);
+        TestBench.run("IntegerScratchScopeExponentFraction", [&] {
+            Mathematics::doExponentFraction(Fraction(1, 3));
+        });
+        Integer NumberPrime(Integer(1).doShiftLeft(2203).doSubtraction(1));
+        TestBench.run("IntegerScratchScopeLucas2203", [&] {
+            Mathematics::isPrimeLucas(NumberPrime);
+        });
     }
 
     TEST_CASE("IntegerSubtraction") {
@@ -133,10 +900,72 @@ TEST_SUITE("Integer") {
 
             CHECK(NumberObject1.doSubtraction(NumberObject2).doCompare(Number1 - Number2) == 0);
         }
+        for (unsigned NumberSize = 1; NumberSize < 100; ++NumberSize) {
+            Integer NumberBorrow = Integer(1).doShiftLeft(NumberSize * 64 + RandomEngine() % 64);
+            CHECK(NumberBorrow.doSubtraction(1).doCompare(NumberBorrow.doShiftRight(1).doAddition(NumberBorrow.doShiftRight(1).doSubtraction(1))) == 0);
+        }
         Integer NumberObject1(RandomEngine()), NumberObject2(RandomEngine());
         TestBench.run("IntegerSubtraction", [&] {
             NumberObject1.doSubtraction(NumberObject2);
         });
+        Integer NumberL1(getRandomInteger(16384)), NumberL2(getRandomInteger(16384));
+        TestBench.run("IntegerSubtraction16384", [&] {
+            NumberL1.doSubtraction(NumberL2);
+        });
+    }
+}
+
+TEST_SUITE("Mathematics") {
+    TEST_CASE("MathematicsFloating") {
+        RandomEngine.seed(RandomDevice() + time(nullptr));
+
+        std::uniform_real_distribution<double> NumberDistribution(-700, 700);
+        for (unsigned NumberEpoch = 0; NumberEpoch < 100000; ++NumberEpoch) {
+            double NumberSource = NumberDistribution(RandomEngine), NumberLimit = 2 * std::numeric_limits<double>::epsilon();
+            double NumberScaled = std::ldexp(NumberSource, (int) (RandomEngine() % 1000) - 500), NumberPositive = std::abs(NumberScaled);
+            CHECK(std::abs(Mathematics::doExponent(NumberSource) - std::exp(NumberSource)) <= NumberLimit * std::exp(NumberSource));
+            CHECK(std::abs(Mathematics::doLogarithmE(NumberPositive) - std::log(NumberPositive)) <= NumberLimit * std::abs(std::log(NumberPositive)));
+            CHECK(std::abs(Mathematics::doSine(NumberScaled) - std::sin(NumberScaled)) <= NumberLimit * std::max(std::abs(std::sin(NumberScaled)), std::numeric_limits<double>::min()));
+            CHECK(std::abs(Mathematics::doCosine(NumberScaled) - std::cos(NumberScaled)) <= NumberLimit * std::abs(std::cos(NumberScaled)));
+            CHECK(Mathematics::doSine((float) NumberSource) == (float) std::sin((double) (float) NumberSource));
+        }
+        CHECK(Mathematics::doExponent(0.0) == 1.0);
+        CHECK(Mathematics::doExponent(1000.0) == std::numeric_limits<double>::infinity());
+        CHECK(Mathematics::doExponent(-1000.0) == 0.0);
+        CHECK(Mathematics::doLogarithmE(1.0) == 0.0);
+        CHECK(Mathematics::doLogarithmE(0.0) == -std::numeric_limits<double>::infinity());
+        CHECK(std::isnan(Mathematics::doLogarithmE(-1.0)));
+        CHECK(std::isnan(Mathematics::doSine(std::numeric_limits<double>::infinity())));
+        CHECK(std::signbit(Mathematics::doSine(-0.0)));
+        CHECK(std::signbit(Mathematics::doTangent(-0.0)));
+        CHECK(Mathematics::doSine(1e300) == std::sin(1e300));
+        CHECK(Mathematics::doCosine(1e22) == std::cos(1e22));
+
+        double NumberSource = 0.5;
+        TestBench.run("MathematicsCosine", [&] {
+            ankerl::nanobench::doNotOptimizeAway(Mathematics::doCosine(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsCosineLibm", [&] {
+            ankerl::nanobench::doNotOptimizeAway(std::cos(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsExponent", [&] {
+            ankerl::nanobench::doNotOptimizeAway(Mathematics::doExponent(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsExponentLibm", [&] {
+            ankerl::nanobench::doNotOptimizeAway(std::exp(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsLogarithmE", [&] {
+            ankerl::nanobench::doNotOptimizeAway(Mathematics::doLogarithmE(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsLogarithmELibm", [&] {
+            ankerl::nanobench::doNotOptimizeAway(std::log(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsSine", [&] {
+            ankerl::nanobench::doNotOptimizeAway(Mathematics::doSine(NumberSource += 1e-9));
+        });
+        TestBench.run("MathematicsSineLibm", [&] {
+            ankerl::nanobench::doNotOptimizeAway(std::sin(NumberSource += 1e-9));
+        });
     }
 }
 